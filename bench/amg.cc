@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+import bench_utils;
+import dxx.cstd.fixed;
+import mesh;
+import mhfe;
+import std;
+
+namespace {
+
+using Real = f64;
+
+// Setup and one step, i.e. the time to the first solution
+inline void time_to_solution(
+    benchmark::State& state, mhfe::Preconditioner precond
+) {
+    const auto prob = make_problem<Real>(state.range(0));
+
+    uz iterations = 0;
+    for (auto _ : state) {
+        mhfe::LMHFE<Real> solver(
+            prob, 1e-8,
+            {
+                .gmres   = { .max_iters = 10000, .restart = 50 },
+                .precond = precond,
+            }
+        );
+        solver.step();
+        iterations = solver.get_iterations();
+        benchmark::DoNotOptimize(solver.get_solution().data());
+    }
+
+    state.SetComplexityN(prob.edges);
+    state.counters["edges"]      = prob.edges;
+    state.counters["iterations"] = iterations;
+} // <-- time_to_solution(state, precond)
+
+inline void lmhfe_ilu0(benchmark::State& state) {
+    time_to_solution(state, mhfe::Preconditioner::ilu0);
+} // <-- lmhfe_ilu0(state)
+
+inline void lmhfe_amg(benchmark::State& state) {
+    time_to_solution(state, mhfe::Preconditioner::amg);
+} // <-- lmhfe_amg(state)
+
+BENCHMARK(lmhfe_ilu0)
+    ->RangeMultiplier(2)->Range(16, 128)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity();
+BENCHMARK(lmhfe_amg)
+    ->RangeMultiplier(2)->Range(16, 128)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+} // <-- namespace <anonymous>
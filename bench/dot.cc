@@ -33,7 +33,73 @@ void dot_product_aligned(benchmark::State& state) {
     }
 }
 
+namespace simd = math::simd;
+
+// Runs `f(kernels, u, v)` over `state.range(1)` entries with the kernels of
+// instruction set `state.range(0)`
+template <bool aligned, typename F>
+inline void with_kernels(benchmark::State& state, F&& f) {
+    const auto isa = static_cast<simd::Isa>(state.range(0));
+    if (!simd::supported(isa)) {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    const auto& k = simd::kernels<f32, aligned>(isa);
+
+    const auto n = static_cast<uz>(state.range(1));
+    using Aligned = std::vector<f32, utils::aligned::Allocator<f32, 64>>;
+    auto u = std::views::take(rng::normal<f32>(-200.0, 200.0), n)
+             | std::ranges::to<Aligned>();
+    auto v = std::views::take(rng::normal<f32>(-200.0, 200.0), n)
+             | std::ranges::to<Aligned>();
+
+    for (auto _ : state) {
+        f(k, u.data(), v.data(), n);
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(f32));
+} // <-- with_kernels<aligned>(state, f)
+
+template <bool aligned>
+inline void kernel_dot(benchmark::State& state) {
+    with_kernels<aligned>(state, [] (const auto& k, auto* u, auto* v, uz n) {
+        benchmark::DoNotOptimize(k.dot(u, v, n));
+    });
+} // <-- kernel_dot<aligned>(state)
+
+template <bool aligned>
+inline void kernel_dot_norm(benchmark::State& state) {
+    with_kernels<aligned>(state, [] (const auto& k, auto* u, auto* v, uz n) {
+        benchmark::DoNotOptimize(k.dot_norm(u, v, n));
+    });
+} // <-- kernel_dot_norm<aligned>(state)
+
+template <bool aligned>
+inline void kernel_axpy(benchmark::State& state) {
+    with_kernels<aligned>(state, [] (const auto& k, auto* u, auto* v, uz n) {
+        k.axpy(1e-3f, u, v, n);
+        benchmark::ClobberMemory();
+    });
+} // <-- kernel_axpy<aligned>(state)
+
+// Instruction set by size: 1K is L1-resident, 256K streams from L2/L3
+inline void kernel_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({ "isa", "n" });
+    for (auto isa : {
+        simd::Isa::scalar, simd::Isa::sse, simd::Isa::avx2, simd::Isa::avx512
+    }) {
+        for (i64 n : { 1024, 256 * 1024 }) {
+            b->Args({ static_cast<i64>(isa), n });
+        }
+    }
+} // <-- kernel_args(b)
+
 BENCHMARK(dot_product);
 BENCHMARK(dot_product_aligned);
+BENCHMARK(kernel_dot<false>)->Apply(kernel_args);
+BENCHMARK(kernel_dot<true>)->Apply(kernel_args);
+BENCHMARK(kernel_dot_norm<false>)->Apply(kernel_args);
+BENCHMARK(kernel_dot_norm<true>)->Apply(kernel_args);
+BENCHMARK(kernel_axpy<false>)->Apply(kernel_args);
+BENCHMARK(kernel_axpy<true>)->Apply(kernel_args);
 
 } // <-- namespace <anonymous>
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+import bench_utils;
+import dxx.cstd.fixed;
+import mesh;
+import mhfe;
+import std;
+
+namespace {
+
+using Real = f64;
+
+// One `FwdDiff` step with `state.range(0)` threads
+inline void fwd_diff_step(benchmark::State& state) {
+    const auto prob = make_problem<Real>(16);
+
+    const auto g_wrt_P = [] (const auto& P, auto& out) {
+        std::ranges::fill(out, 1.0 / P.size());
+    }; // <-- g_wrt_P
+    const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+
+    mhfe::FwdDiff<Real, decltype(g_wrt_P), decltype(g_wrt_a)> solver(
+        prob, 1e-8, g_wrt_P, g_wrt_a,
+        {
+            .gmres   = { .restart = 50 },
+            .precond = mhfe::Preconditioner::ilu0,
+            .threads = static_cast<uz>(state.range(0)),
+        }
+    );
+
+    for (auto _ : state) {
+        solver.step();
+        benchmark::DoNotOptimize(solver.get_sensitivity().data());
+    }
+
+    state.counters["cells"]   = prob.cells;
+    state.counters["threads"] = state.range(0);
+} // <-- fwd_diff_step(state)
+
+BENCHMARK(fwd_diff_step)
+    ->Apply([] (benchmark::internal::Benchmark* b) {
+        const auto max = std::max(std::thread::hardware_concurrency(), 1u);
+        for (uz t = 1; t < max; t *= 2) b->Arg(t);
+        b->Arg(max);
+    })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // <-- namespace <anonymous>
@@ -1,3 +1,36 @@
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
+#include "mhfe_commit.hh"
+
+import std;
+
+/*
+ * `BENCHMARK_MAIN()` that also writes the results as JSON to `bench.json`
+ * unless `--benchmark_out` is given, so that runs on different commits can
+ * be compared (e.g. with Google Benchmark's `tools/compare.py`)
+ */
+int main(int argc, char** argv) {
+    std::vector<char*> args(argv, argv + argc);
+
+    std::string out    = "--benchmark_out=bench.json";
+    std::string format = "--benchmark_out_format=json";
+    const bool has_out = std::ranges::any_of(
+        args, [] (std::string_view arg) {
+            return arg.starts_with("--benchmark_out=");
+        }
+    );
+    if (!has_out) {
+        args.push_back(out.data());
+        args.push_back(format.data());
+    }
+
+    benchmark::AddCustomContext("commit", MHFE_COMMIT);
+
+    int args_count = static_cast<int>(args.size());
+    benchmark::Initialize(&args_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
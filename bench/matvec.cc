@@ -16,18 +16,21 @@ const auto a_al = std::views::take(rng::normal<f32>(-200.0, 200.0), 1024)
                   | std::ranges::to<std::vector<f32, utils::aligned::Allocator<f32, 256>>>();
 
 const auto A_sparse = [] {
-    math::CSR<f32> ret(1024, 1024);
+    math::CSR<f32>::Builder builder(1024, 1024);
+    builder.reserve(1024 * 7);
     auto gen = rng::normal<f32>(-200.0, 200.0).begin();
-    for (i64 i : range(0uz, ret.get_rows())) {
-        for (i64 j : range(0uz, ret.get_cols())) {
+    for (i64 i : range(0, 1024)) {
+        for (i64 j : range(0, 1024)) {
             if (std::abs(i - j) <= 3) {
-                ret[i, j] = *++gen;
+                builder.add(i, j, *++gen);
             }
         }
     }
-    return ret;
+    return builder.build();
 } (); // <-- A_sparse
 
+const math::SellCS<f32> A_sell{ A_sparse };
+
 const auto A_dense = [] {
     std::vector<f32> ret{};
     for (uz i : range(0uz, 1024uz)) {
@@ -66,9 +69,25 @@ inline void matvec_sparse_aligned(benchmark::State& state) {
     }
 } // <-- matvec_sparse(state)
 
+inline void matvec_sell(benchmark::State& state) {
+    std::vector<f32> out(a.size());
+    for (auto _ : state) {
+        math::matvec(A_sell, a, out);
+    }
+} // <-- matvec_sell(state)
+
+inline void matvec_sell_aligned(benchmark::State& state) {
+    std::vector<f32> out(a.size());
+    for (auto _ : state) {
+        math::matvec(A_sell, a_al, out);
+    }
+} // <-- matvec_sell_aligned(state)
+
 BENCHMARK(matvec_dense);
 BENCHMARK(matvec_dense_aligned);
 BENCHMARK(matvec_sparse);
 BENCHMARK(matvec_sparse_aligned);
+BENCHMARK(matvec_sell);
+BENCHMARK(matvec_sell_aligned);
 
 } // <-- namespace <anonymous>
@@ -0,0 +1,290 @@
+#include <benchmark/benchmark.h>
+
+import bench_utils;
+import dxx.cstd.fixed;
+import math;
+import mesh;
+import mhfe;
+import std;
+import utils;
+
+/*
+ * The solver pipeline end to end, for `f32` and `f64` on `2n x n`
+ * rectangles: mesh generation and loading, `LMHFE` construction and steps,
+ * `FwdDiff` and `FinDiff`.
+ *
+ * Counters: `bytes_per_second` (mesh bytes produced or parsed, CSR bytes
+ * assembled or streamed by the solves), `nnz/s`, `iterations` (per step)
+ * and `peak_rss` (MiB, high-water mark since the benchmark started)
+ */
+namespace {
+
+template <typename Real>
+using Mesh = mesh::Triangular<Real>;
+
+// Solver tolerance reachable in `Real`
+template <typename Real>
+inline constexpr Real tol = std::same_as<Real, f32> ? 1e-5 : 1e-8;
+
+// Restarts the `peak_rss()` high-water mark. Linux only, a no-op elsewhere
+inline void reset_peak_rss() {
+    std::ofstream{ "/proc/self/clear_refs" } << "5";
+} // <-- reset_peak_rss()
+
+// `VmHWM` of the process in MiB, 0 where `/proc` is not available
+inline double peak_rss() {
+    std::ifstream status{ "/proc/self/status" };
+    for (std::string line; std::getline(status, line);) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stod(line.substr(6)) / 1024; // Reported in kB
+        }
+    }
+    return 0;
+} // <-- peak_rss()
+
+template <typename Real>
+uz mesh_bytes(const Mesh<Real>& m) {
+    return m.points.size() * sizeof(typename Mesh<Real>::Point)
+           + m.edges.size() * sizeof(typename Mesh<Real>::Edge)
+           + m.cells.size() * sizeof(typename Mesh<Real>::Cell);
+} // <-- mesh_bytes(m)
+
+template <typename Real>
+uz csr_bytes(const math::CSR<Real>& A) {
+    return A.get_nnz() * (sizeof(Real) + sizeof(uz))
+           + (A.get_rows() + 1) * sizeof(uz);
+} // <-- csr_bytes(A)
+
+template <typename Real>
+mhfe::Options<Real> options() {
+    return {
+        .gmres   = { .max_iters = 10000, .restart = 50 },
+        .precond = mhfe::Preconditioner::ilu0,
+    };
+} // <-- options<Real>()
+
+// Size counters shared by all benchmarks
+template <typename Real>
+void count_problem(benchmark::State& state, const Mesh<Real>& m) {
+    state.counters["cells"] = m.cells.size();
+    state.counters["edges"] = m.edges.size();
+    state.counters["peak_rss"] = peak_rss();
+} // <-- count_problem(state, m)
+
+/*
+ * Solve counters over `matvecs` products with `A`, most of the memory
+ * traffic of a Krylov solve
+ */
+template <typename Real>
+void count_solves(
+    benchmark::State& state,
+    const math::CSR<Real>& A,
+    uz iterations,
+    uz matvecs
+) {
+    using benchmark::Counter;
+
+    state.SetBytesProcessed(matvecs * csr_bytes(A));
+    state.counters["nnz/s"] = Counter(
+        static_cast<double>(matvecs * A.get_nnz()), Counter::kIsRate
+    );
+    state.counters["iterations"] = Counter(
+        static_cast<double>(iterations), Counter::kAvgIterations
+    );
+} // <-- count_solves(state, A, iterations, matvecs)
+
+template <typename Real>
+void pipeline_gen_rect(benchmark::State& state) {
+    const uz n = state.range(0);
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        auto m = make_mesh<Real>(n);
+        benchmark::DoNotOptimize(m.cells.data());
+    }
+
+    const auto m = make_mesh<Real>(n);
+    state.SetBytesProcessed(state.iterations() * mesh_bytes(m));
+    count_problem(state, m);
+} // <-- pipeline_gen_rect<Real>(state)
+
+// `Triangular::read` of the text format
+template <typename Real>
+void pipeline_read(benchmark::State& state) {
+    const auto m = make_mesh<Real>(state.range(0));
+    std::ostringstream dump;
+    m.dump(dump);
+    const auto text = std::move(dump).str();
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        Mesh<Real> read{};
+        read.read(std::istringstream{ text });
+        benchmark::DoNotOptimize(read.cells.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * text.size());
+    count_problem(state, m);
+} // <-- pipeline_read<Real>(state)
+
+// `mesh::binary::read`, for comparison
+template <typename Real>
+void pipeline_read_binary(benchmark::State& state) {
+    const auto m = make_mesh<Real>(state.range(0));
+    std::ostringstream dump;
+    mesh::binary::write(m, dump);
+    const auto bytes = std::move(dump).str();
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        auto read = mesh::binary::read<Real>(std::istringstream{ bytes });
+        benchmark::DoNotOptimize(read.cells.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+    count_problem(state, m);
+} // <-- pipeline_read_binary<Real>(state)
+
+// `LMHFE` construction: cell caches, `sysmat` assembly, ILU(0)
+template <typename Real>
+void pipeline_lmhfe_prepare(benchmark::State& state) {
+    using benchmark::Counter;
+
+    const auto prob = make_problem<Real>(state.range(0));
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        mhfe::LMHFE<Real> solver(prob, tol<Real>, options<Real>());
+        benchmark::DoNotOptimize(&solver);
+    }
+
+    const mhfe::LMHFE<Real> solver(prob, tol<Real>, options<Real>());
+    const auto& A = solver.get_sysmat();
+    state.SetBytesProcessed(state.iterations() * csr_bytes(A));
+    state.counters["nnz/s"] = Counter(
+        static_cast<double>(state.iterations() * A.get_nnz()),
+        Counter::kIsRate
+    );
+    count_problem(state, prob.mesh);
+} // <-- pipeline_lmhfe_prepare<Real>(state)
+
+template <typename Real>
+void pipeline_lmhfe_step(benchmark::State& state) {
+    const auto prob = make_problem<Real>(state.range(0));
+    mhfe::LMHFE<Real> solver(prob, tol<Real>, options<Real>());
+    reset_peak_rss();
+
+    uz iterations = 0;
+    for (auto _ : state) {
+        solver.step();
+        iterations += solver.get_iterations();
+        benchmark::DoNotOptimize(solver.get_solution().data());
+    }
+
+    // One product per iteration and one for the initial residual
+    count_solves(
+        state, solver.get_sysmat(),
+        iterations, iterations + state.iterations()
+    );
+    count_problem(state, prob.mesh);
+} // <-- pipeline_lmhfe_step<Real>(state)
+
+template <typename Real>
+auto make_fwd_diff(const mhfe::Problem<Real>& prob) {
+    const auto g_wrt_P = [] (const auto& P, auto& out) {
+        std::ranges::fill(out, Real{1} / P.size());
+    }; // <-- g_wrt_P
+    const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+
+    using FwdDiff = mhfe::FwdDiff<Real, decltype(g_wrt_P), decltype(g_wrt_a)>;
+    return std::make_unique<FwdDiff>(
+        prob, tol<Real>, g_wrt_P, g_wrt_a, options<Real>()
+    );
+} // <-- make_fwd_diff<Real>(prob)
+
+// `FwdDiff` construction, dominated by the dense sensitivity buffers
+template <typename Real>
+void pipeline_fwd_diff_prepare(benchmark::State& state) {
+    const auto prob = make_problem<Real>(state.range(0));
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        auto solver = make_fwd_diff(prob);
+        benchmark::DoNotOptimize(solver.get());
+    }
+
+    count_problem(state, prob.mesh);
+} // <-- pipeline_fwd_diff_prepare<Real>(state)
+
+template <typename Real>
+void pipeline_fwd_diff_step(benchmark::State& state) {
+    const auto prob = make_problem<Real>(state.range(0));
+    auto solver = make_fwd_diff(prob);
+    reset_peak_rss();
+
+    uz iterations = 0;
+    for (auto _ : state) {
+        solver->step();
+        iterations += solver->get_iterations();
+        benchmark::DoNotOptimize(solver->get_sensitivity().data());
+    }
+
+    state.counters["iterations"] = benchmark::Counter(
+        static_cast<double>(iterations), benchmark::Counter::kAvgIterations
+    );
+    count_problem(state, prob.mesh);
+} // <-- pipeline_fwd_diff_step<Real>(state)
+
+// `FinDiff` step: one perturbed solve per cell and the base one
+template <typename Real>
+void pipeline_fin_diff_step(benchmark::State& state) {
+    const auto prob = make_problem<Real>(state.range(0));
+    mhfe::FinDiff<Real> solver(prob, tol<Real>, 0.01, options<Real>());
+    reset_peak_rss();
+
+    for (auto _ : state) {
+        solver.step();
+        benchmark::DoNotOptimize(&solver);
+    }
+
+    state.counters["members"] = prob.cells;
+    count_problem(state, prob.mesh);
+} // <-- pipeline_fin_diff_step<Real>(state)
+
+// `n` from `lo` to `hi` in powers of 2
+template <i64 lo, i64 hi>
+void sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("n")->RangeMultiplier(2)->Range(lo, hi);
+} // <-- sizes<lo, hi>(b)
+
+BENCHMARK_TEMPLATE(pipeline_gen_rect, f32)->Apply(sizes<16, 256>);
+BENCHMARK_TEMPLATE(pipeline_gen_rect, f64)->Apply(sizes<16, 256>);
+BENCHMARK_TEMPLATE(pipeline_read, f32)->Apply(sizes<16, 256>);
+BENCHMARK_TEMPLATE(pipeline_read, f64)->Apply(sizes<16, 256>);
+BENCHMARK_TEMPLATE(pipeline_read_binary, f32)->Apply(sizes<16, 256>);
+BENCHMARK_TEMPLATE(pipeline_read_binary, f64)->Apply(sizes<16, 256>);
+
+BENCHMARK_TEMPLATE(pipeline_lmhfe_prepare, f32)
+    ->Apply(sizes<16, 128>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_lmhfe_prepare, f64)
+    ->Apply(sizes<16, 128>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_lmhfe_step, f32)
+    ->Apply(sizes<16, 128>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_lmhfe_step, f64)
+    ->Apply(sizes<16, 128>)->Unit(benchmark::kMillisecond);
+
+// The sensitivities are dense in the cell count, so the sizes stay small
+BENCHMARK_TEMPLATE(pipeline_fwd_diff_prepare, f32)
+    ->Apply(sizes<4, 16>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fwd_diff_prepare, f64)
+    ->Apply(sizes<4, 16>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fwd_diff_step, f32)
+    ->Apply(sizes<4, 16>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fwd_diff_step, f64)
+    ->Apply(sizes<4, 16>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fin_diff_step, f32)
+    ->Apply(sizes<4, 8>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fin_diff_step, f64)
+    ->Apply(sizes<4, 8>)->Unit(benchmark::kMillisecond);
+
+} // <-- namespace <anonymous>
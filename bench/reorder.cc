@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+import bench_utils;
+import dxx.cstd.fixed;
+import math;
+import mesh;
+import mhfe;
+import std;
+
+namespace {
+
+using Real = f64;
+using Mesh = mesh::Triangular<Real>;
+
+// `state.range(0)` of the benchmarks below
+enum Numbering : i64 {
+    shuffled, // Random, like an unstructured mesh from a preprocessor
+    rcm,
+    hilbert,
+}; // <-- enum Numbering
+
+// `2n x n` rectangle renumbered at random, then reordered by `numbering`
+Mesh make_mesh(uz n, Numbering numbering) {
+    auto ret = mesh::gen_rect<Real>(2 * n, n, 20, 10).value();
+
+    mesh::permute(ret, mesh::shuffling(ret, std::mt19937{ 1 }));
+
+    switch (numbering) {
+    case shuffled:
+        break;
+    case rcm:
+        mesh::reorder(ret, mesh::Order::rcm);
+        break;
+    case hilbert:
+        mesh::reorder(ret, mesh::Order::hilbert);
+        break;
+    }
+    return ret;
+} // <-- make_mesh(n, numbering)
+
+// SpMV with the edge system's pattern
+inline void reorder_spmv(benchmark::State& state) {
+    const auto m = make_mesh(128, static_cast<Numbering>(state.range(0)));
+
+    typename math::CSR<Real>::Builder builder(m.edges.size(), m.edges.size());
+    builder.reserve(9 * m.cells.size());
+    for (const auto& cell : m.cells) {
+        for (auto ei : cell.edges) {
+            for (auto ej : cell.edges) builder.add(ei, ej, ei == ej ? 4 : -1);
+        }
+    }
+    const auto A = builder.build();
+
+    const std::vector<Real> x(m.edges.size(), 1);
+    std::vector<Real> y(m.edges.size());
+    for (auto _ : state) {
+        std::ranges::fill(y, 0);
+        math::matvec(A, x, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+
+    state.counters["edges"] = m.edges.size();
+} // <-- reorder_spmv(state)
+
+// `LMHFE::step()`. Jacobi does not depend on the numbering, so only the
+// memory access pattern changes
+inline void reorder_step(benchmark::State& state) {
+    const auto prob = make_problem(
+        make_mesh(128, static_cast<Numbering>(state.range(0)))
+    );
+
+    mhfe::LMHFE<Real> solver(prob, 1e-8, {
+        .gmres   = { .restart = 50 },
+        .precond = mhfe::Preconditioner::jacobi,
+    });
+
+    for (auto _ : state) {
+        solver.step();
+        benchmark::DoNotOptimize(solver.get_solution().data());
+    }
+
+    state.counters["cells"]      = prob.cells;
+    state.counters["iterations"] = solver.get_iterations();
+} // <-- reorder_step(state)
+
+BENCHMARK(reorder_spmv)
+    ->ArgName("numbering")
+    ->Arg(shuffled)->Arg(rcm)->Arg(hilbert);
+BENCHMARK(reorder_step)
+    ->ArgName("numbering")
+    ->Arg(shuffled)->Arg(rcm)->Arg(hilbert)
+    ->Unit(benchmark::kMillisecond);
+
+} // <-- namespace <anonymous>
@@ -7,19 +7,51 @@ import utils;
 using Real = f64;
 
 int main(int argc, char** argv) {
-    if (argc != 5) {
-        std::println(std::cerr, "Usage: {} Nx Ny X Y", argv[0]);
+    const auto program = argv[0];
+
+    // Optional leading `-b`: binary output, see `mesh::binary`
+    const bool binary = argc > 1 && std::string_view{ argv[1] } == "-b";
+    if (binary) {
+        --argc;
+        ++argv;
+    }
+
+    if (argc != 5 && argc != 6) {
+        std::println(std::cerr, "Usage: {} [-b] Nx Ny X Y [levels]", program);
+        std::println(
+            std::cerr,
+            "  -b     - write the binary, memory-mappable format "
+            "instead of text"
+        );
+        std::println(
+            std::cerr,
+            "  levels - uniform refinements of the Nx x Ny grid, "
+            "each one quadruples the cells"
+        );
         return EXIT_FAILURE;
     }
 
-    const uz   N_x = std::stol(argv[1]);
-    const uz   N_y = std::stol(argv[2]);
-    const Real X   = std::stod(argv[3]);
-    const Real Y   = std::stod(argv[4]);
+    const uz   N_x    = std::stol(argv[1]);
+    const uz   N_y    = std::stol(argv[2]);
+    const Real X      = std::stod(argv[3]);
+    const Real Y      = std::stod(argv[4]);
+    const uz   levels = (argc == 6) ? std::stol(argv[5]) : 0;
 
-    if (const auto mo = mesh::gen_rect(N_x, N_y, X, Y); mo.has_value()) {
-        mo.value().dump(std::cout);
-    } else {
+    auto mo = mesh::gen_rect(N_x, N_y, X, Y);
+    if (!mo.has_value()) {
         return EXIT_FAILURE;
     }
+
+    auto m = std::move(mo).value();
+    for ([[maybe_unused]] auto _ : range(0uz, levels)) {
+        m = m.refined();
+    }
+
+    // The text dump is line-per-value
+    std::ios::sync_with_stdio(false);
+    if (binary) {
+        mesh::binary::write(m, std::cout);
+    } else {
+        m.dump(std::cout);
+    }
 }
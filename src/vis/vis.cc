@@ -6,15 +6,33 @@ import std;
 import utils;
 
 int main(int argc, char** argv) {
-    if (argc != 3 && argc != 5) {
-        std::println(std::cerr, "Usage: {} T dt [x_mul y_mul]", argv[0]);
+    const auto program = argv[0];
+
+    // Optional leading `-s stride`: records every `stride`-th step
+    uz stride = 1;
+    if (argc > 2 && std::string_view{ argv[1] } == "-s") {
+        // Negative strides would wrap around in `uz`, map them to the
+        // rejected 0 instead
+        stride = static_cast<uz>(std::max(std::stoll(argv[2]), 0ll));
+        argc -= 2;
+        argv += 2;
+    }
+
+    if ((argc != 3 && argc != 5) || stride == 0) {
+        std::println(
+            std::cerr, "Usage: {} [-s stride] T dt [x_mul y_mul]", program
+        );
+        std::println(
+            std::cerr,
+            "  Writes solution, fwddiff and fd_diff .xdmf series (with their "
+            "binary data) to the working directory"
+        );
         return EXIT_FAILURE;
     }
 
     using Real = f64;
 
-    using Mesh = mesh::Triangular<Real>;
-    using Cell = Mesh::Cell;
+    namespace output = mhfe::output;
 
     const Real T  = std::stod(argv[1]);
     const Real dt = std::stod(argv[2]);
@@ -70,39 +88,22 @@ int main(int argc, char** argv) {
 
     std::println(std::cerr, "Running vanilla LMHFE");
 
-    std::println("import numpy as np");
-    std::println("import pyvista as pv");
-
-    std::println("points = {}", mo->points);
-    std::println("cells = {}", std::views::transform(mo->cells, &Cell::points));
-
-    std::println("surf = pv.PolyData(");
-    std::println("    [ [ p[0], p[1], 0 ] for p in points ],");
-    std::println("    [ [ 3, *c ] for c in cells ],");
-    std::println(")");
+    const output::Options out_options{ .stride = stride };
 
     const auto s_ms = utils::timeit([&] {
         mhfe::LMHFE<Real> solver{ prob, 1e-7 };
-        std::println("solution = np.array([");
+        output::Writer<Real> out{
+            "solution", prob.mesh, { { .name = "solution" } }, out_options
+        };
         while (solver.get_time() < T) {
             std::print(std::cerr, "\r{:20}/{:<20}", solver.get_time(), T);
             solver.step();
-            std::println("    {},", solver.get_solution());
+            out.push(solver.get_time(), { solver.get_solution() });
         }
-        std::println("])");
+        out.close();
         std::println(std::cerr, "\nDone");
     }).count();
 
-    std::println(
-R"py(
-pl = pv.Plotter(off_screen=True)
-for i, sol in enumerate(solution):
-    pl.clear()
-    pl.add_mesh(surf, scalars=sol)
-    pl.save_graphic(f'solution/{}.svg')
-)py", "{i}"
-    );
-
     const auto fw_ms = utils::timeit([&] {
         const auto g_wrt_s = [] (const auto& p, auto& o) {
             std::ranges::fill(o, 1.0 / p.size());
@@ -111,54 +112,42 @@ for i, sol in enumerate(solution):
         mhfe::FwdDiff<Real, decltype(g_wrt_s), decltype(g_wrt_a)> solver{
             prob, 1e-7, g_wrt_s, g_wrt_a
         };
-        std::println("fwd_diff = np.array([");
+        output::Writer<Real> out{
+            "fwddiff", prob.mesh, { { .name = "sensitivity" } }, out_options
+        };
         while (solver.get_time() < T) {
             std::print(std::cerr, "\r{:20}/{:<20}", solver.get_time(), T);
             solver.step();
-            std::println("    {},", solver.get_sensitivity());
+            out.push(solver.get_time(), { solver.get_sensitivity() });
         }
-        std::println("])");
+        out.close();
         std::println(std::cerr, "\nDone");
     }).count();
 
-    std::println(
-R"py(
-for i, sol in enumerate(fwd_diff):
-    pl.clear()
-    pl.add_mesh(surf, scalars=sol)
-    pl.save_graphic(f'fwddiff/{}.svg')
-)py", "{i}"
-    );
-
     const auto fd_ms = utils::timeit([&] {
-        const auto g_wrt_s = [] (const auto& p, auto& o) {
-            std::ranges::fill(o, 1.0 / p.size());
-        };
-        const auto g_wrt_a = [] (auto& o) { std::ranges::fill(o, 0); };
         mhfe::FinDiff<Real> solver{ prob, 1e-7, 0.01 };
         while (solver.get_time() < T) {
             std::print(std::cerr, "\r{:20}/{:<20}", solver.get_time(), T);
             solver.step();
         }
-        std::println(
-            "fd_diff = np.array({})",
-            solver.get_sensitivity(
-                [] (const auto& p) {
-                    return std::reduce(p.cbegin(), p.cend()) / p.size();
-                }
-            )
+
+        output::Writer<Real> out{
+            "fd_diff", prob.mesh, { { .name = "sensitivity" } }
+        };
+        out.push(
+            solver.get_time(),
+            {
+                solver.get_sensitivity(
+                    [] (const auto& p) {
+                        return std::reduce(p.cbegin(), p.cend()) / p.size();
+                    }
+                )
+            }
         );
+        out.close();
         std::println(std::cerr, "\nDone");
     }).count();
 
-    std::println(
-R"py(
-pl.clear()
-pl.add_mesh(surf, scalars=fd_diff)
-pl.save_graphic(f'fd_diff.svg')
-)py", "{i}"
-    );
-
     std::println(
         std::cerr,
         "Took: {}ms | {}ms | {}ms", s_ms, fw_ms, fd_ms
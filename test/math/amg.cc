@@ -0,0 +1,68 @@
+import test_utils;
+
+namespace test::math::amg {
+
+// 5-point Laplacian on an n x n grid with Dirichlet boundary
+::math::CSR<f64> laplacian(uz n) {
+    ::math::CSR<f64>::Builder builder(n * n, n * n);
+    builder.reserve(5 * n * n);
+    for (uz i : range(0uz, n)) {
+        for (uz j : range(0uz, n)) {
+            const auto row = i * n + j;
+            builder.add(row, row, 4.0);
+            if (i > 0)     builder.add(row, row - n, -1.0);
+            if (i + 1 < n) builder.add(row, row + n, -1.0);
+            if (j > 0)     builder.add(row, row - 1, -1.0);
+            if (j + 1 < n) builder.add(row, row + 1, -1.0);
+        }
+    }
+    return builder.build();
+} // <-- laplacian(n)
+
+const UnitTest standalone{
+    "standalone", [] {
+        namespace rng = utils::random::generators;
+
+        const auto A = laplacian(64);
+        const auto n = A.get_rows();
+
+        ::math::amg::Hierarchy<f64> amg{ A };
+        test(amg.get_levels() > 1);
+        for (auto level : range(1uz, amg.get_levels())) {
+            test(amg.get_rows(level) < amg.get_rows(level - 1));
+        }
+
+        const auto x0 = std::views::take(rng::normal<f64>(), n)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b = ::math::matvec(A, x0);
+
+        std::vector<f64> x(n, 0);
+        test(amg.solve(b, x, 1e-10));
+        test(amg.get_residual() <= 1e-10);
+        std::println("    - {} levels, {} cycles", amg.get_levels(), amg.get_cycles());
+        test(all_close(x, x0, 1e-6));
+    }
+}; // <-- standalone
+
+const UnitTest preconditioner{
+    "preconditioner", [] {
+        // Iteration counts should not grow with the grid size
+        std::vector<uz> iters;
+        for (uz size : { 32uz, 64uz, 128uz }) {
+            const auto A = laplacian(size);
+            const std::vector<f64> b(A.get_rows(), 1);
+
+            const ::math::amg::Hierarchy<f64> amg{ A };
+            ::math::gmres::Workspace<f64> ws{};
+            std::vector<f64> x(A.get_rows(), 0);
+            test(::math::gmres::solve(
+                A, b, x, ws, amg, { .max_iters = 200, .tol = 1e-8 }
+            ));
+            iters.push_back(ws.iterations);
+        }
+        std::println("    - iterations: {}", iters);
+        test(iters.back() <= iters.front() + 5);
+    }
+}; // <-- preconditioner
+
+} // <-- namespace test::math::amg
@@ -0,0 +1,124 @@
+import test_utils;
+
+namespace test::math::cg {
+
+// 2D 5-point Laplacian on an `n x n` grid with a variable diagonal shift
+::math::CSR<f64> laplacian(uz n) {
+    ::math::CSR<f64>::Builder builder(n * n, n * n);
+    for (uz i : range(0uz, n)) {
+        for (uz j : range(0uz, n)) {
+            const auto row = i * n + j;
+            builder.add(row, row, 4.0 + 0.01 * static_cast<f64>(i + j));
+            if (i > 0)     builder.add(row, row - n, -1.0);
+            if (i + 1 < n) builder.add(row, row + n, -1.0);
+            if (j > 0)     builder.add(row, row - 1, -1.0);
+            if (j + 1 < n) builder.add(row, row + 1, -1.0);
+        }
+    }
+    return builder.build();
+} // <-- laplacian(n)
+
+const UnitTest test_spd{
+    "spd", [] {
+        namespace rng = utils::random::generators;
+
+        static constexpr uz n = 30;
+        const auto A = laplacian(n);
+        const ::math::cg::Options<f64> opt{ .max_iters = 1000, .tol = 1e-10 };
+        ::math::cg::Workspace<f64> ws{};
+
+        const auto x0 = std::views::take(rng::normal<f64>(), n * n)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b0 = ::math::matvec(A, x0);
+
+        const auto check = [&] (const std::vector<f64>& x) {
+            test(ws.residual <= opt.tol);
+            const auto b = ::math::matvec(A, x);
+            const auto atol = std::ranges::max(b0) * 1e-8;
+            for (auto [ bi, b0i ] : std::views::zip(b, b0)) {
+                test(std::abs(bi - b0i) <= atol);
+            }
+        }; // <-- check(x)
+
+        std::vector<f64> x(n * n, 0);
+        test(::math::cg::solve(A, b0, x, ws, opt));
+        check(x);
+        const auto plain_iters = ws.iterations;
+
+        std::ranges::fill(x, 0);
+        const ::math::precond::SSOR<f64> ssor{ A, 1.0 };
+        test(::math::cg::solve(A, b0, x, ws, ssor, opt));
+        check(x);
+        test(ws.iterations < plain_iters);
+
+        // Warm start from the solution
+        test(::math::cg::solve(A, b0, x, ws, opt));
+        test(ws.iterations == 0);
+    }
+}; // <-- spd
+
+const UnitTest test_not_converged{
+    "not_converged", [] {
+        const auto A = laplacian(20);
+        const std::vector<f64> b(400, 1);
+        std::vector<f64> x(400, 0);
+
+        ::math::cg::Workspace<f64> ws{};
+        test(!::math::cg::solve(A, b, x, ws, { .max_iters = 3, .tol = 1e-12 }));
+        test(ws.iterations == 3);
+
+        // Negative definite: breaks down on the first step
+        ::math::CSR<f64>::Builder builder(2, 2);
+        builder.add(0, 0, -1.0);
+        builder.add(1, 1, -2.0);
+        std::ranges::fill(x, 0);
+        test(!::math::cg::solve(
+            builder.build(), std::vector<f64>{ 1, 1 },
+            std::span{ x }.first(2), ws
+        ));
+    }
+}; // <-- not_converged
+
+const UnitTest test_interleaved{
+    "interleaved", [] {
+        namespace rng = utils::random::generators;
+
+        static constexpr uz n = 20;
+        static constexpr uz rows = n * n;
+        static constexpr uz k = 5;
+        const auto A = laplacian(n);
+        const ::math::precond::Jacobi<f64> jacobi{ A };
+        const ::math::cg::Options<f64> opt{ .max_iters = 1000, .tol = 1e-10 };
+
+        // Interleaved right-hand sides, the last one zero
+        auto X0 = std::views::take(rng::normal<f64>(), rows * k)
+                | std::ranges::to<std::vector<f64>>();
+        for (uz i : range(0uz, rows)) X0[i * k + k - 1] = 0;
+        std::vector<f64> B(rows * k, 0);
+        ::math::matvec_block(A, X0, B, k);
+
+        ::math::cg::BlockWorkspace<f64> ws{};
+        std::vector<f64> X(rows * k, 1);
+        test(::math::cg::solve_interleaved(A, B, X, k, ws, jacobi, opt));
+        test(ws.iterations[k - 1] == 0);
+
+        ::math::cg::Workspace<f64> single_ws{};
+        for (uz r : range(0uz, k)) {
+            std::vector<f64> b(rows);
+            for (uz i : range(0uz, rows)) b[i] = B[i * k + r];
+            std::vector<f64> x(rows, 1);
+            test(::math::cg::solve(A, b, x, single_ws, jacobi, opt));
+            // Same iterations up to the rounding of the dot products
+            test(
+                std::max(single_ws.iterations, ws.iterations[r])
+                - std::min(single_ws.iterations, ws.iterations[r]) <= 1
+            );
+
+            for (uz i : range(0uz, rows)) {
+                test(std::abs(x[i] - X[i * k + r]) <= 1e-8);
+            }
+        }
+    }
+}; // <-- interleaved
+
+} // <-- namespace test::math::cg
@@ -51,4 +51,47 @@ const UnitTest create{
     }
 }; // <-- create
 
+const UnitTest sorted_push{
+    "sorted_push", [] {
+        ::math::CSR<f32> csr(1, 4);
+        csr.push(0, 3, 3);
+        csr.push(0, 0, 0.5);
+        csr.push(0, 2, 2);
+        csr.push(0, 1, 1);
+
+        test(std::ranges::equal(csr.get_row(0), std::vector<uz>{ 0, 1, 2, 3 }));
+        test(csr.at(0, 0) == 0.5);
+        test(csr.at(0, 3) == 3);
+    }
+}; // <-- sorted_push
+
+const UnitTest builder{
+    "builder", [] {
+        ::math::CSR<f32>::Builder b(3, 3);
+        b.add(2, 2, 1);
+        b.add(0, 2, 4);
+        b.add(0, 0, 1);
+        b.add(2, 2, 2);
+        b.add(0, 2, 1);
+
+        const auto csr = b.build();
+
+        test(csr.get_rows() == 3);
+        test(csr.get_cols() == 3);
+
+        test(std::ranges::equal(csr.get_row(0), std::vector<uz>{ 0, 2 }));
+        test(csr.get_row(1).empty());
+        test(std::ranges::equal(csr.get_row(2), std::vector<uz>{ 2 }));
+
+        test(csr.at(0, 0) == 1);
+        test(csr.at(0, 1) == 0);
+        test(csr.at(0, 2) == 5);
+        test(csr.at(1, 1) == 0);
+        test(csr.at(2, 2) == 3);
+
+        test(csr.find(1, 0) == nullptr);
+        test(csr.find(2, 1) == nullptr);
+    }
+}; // <-- builder
+
 } // <-- namespace test::math::csr
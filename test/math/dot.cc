@@ -10,4 +10,68 @@ const UnitTest test1 = [] {
     test(10.0f == ::math::dot(v, u));
 }; // <-- test1
 
+template <typename Real>
+void test_kernels() {
+    namespace rng = utils::random::generators;
+    namespace simd = ::math::simd;
+
+    // Odd size, so that every kernel runs its remainder loop
+    static constexpr uz n = 1027;
+    using Aligned = std::vector<Real, utils::aligned::Allocator<Real, 64>>;
+    const auto u = std::views::take(rng::normal<Real>(), n)
+                 | std::ranges::to<Aligned>();
+    const auto v = std::views::take(rng::normal<Real>(), n)
+                 | std::ranges::to<Aligned>();
+
+    long double d_ref = 0;
+    long double s_ref = 0;
+    for (auto [ ue, ve ] : std::views::zip(u, v)) {
+        d_ref += static_cast<long double>(ue) * ve;
+        s_ref += static_cast<long double>(ve) * ve;
+    }
+    const auto tol = 64 * n * std::numeric_limits<Real>::epsilon();
+    const auto close = [tol] (Real r, long double ref, long double scale) {
+        return std::abs(r - ref) <= tol * scale;
+    }; // <-- close(r, ref, scale)
+
+    for (auto isa : {
+        simd::Isa::scalar, simd::Isa::sse, simd::Isa::avx2, simd::Isa::avx512
+    }) {
+        if (!simd::supported(isa)) continue;
+
+        // Unaligned kernels off the 64-byte boundary
+        const auto s_off = s_ref - static_cast<long double>(v[0]) * v[0];
+        const auto [ d_off, s_off_k ] = simd::kernels<Real>(isa).dot_norm(
+            v.data() + 1, v.data() + 1, n - 1
+        );
+        test(close(d_off, s_off, s_off));
+        test(close(s_off_k, s_off, s_off));
+
+        for (const auto& k : {
+            simd::kernels<Real, false>(isa), simd::kernels<Real, true>(isa)
+        }) {
+            test(close(k.dot(u.data(), v.data(), n), d_ref, s_ref));
+
+            const auto [ d, s ] = k.dot_norm(u.data(), v.data(), n);
+            test(close(d, d_ref, s_ref));
+            test(close(s, s_ref, s_ref));
+
+            auto y = v;
+            k.axpy(Real{-2}, u.data(), y.data(), n);
+            for (auto [ ye, ue, ve ] : std::views::zip(y, u, v)) {
+                test(std::abs(ye - (ve - 2 * ue)) <= 4 * tol / n);
+            }
+        }
+    }
+
+    // The generic entry points pick the aligned kernels for `Aligned`
+    const auto& aligned = simd::kernels<Real, true>();
+    test(::math::dot(u, v) == aligned.dot(u.data(), v.data(), n));
+    const std::vector<Real> u_plain(u.begin(), u.end());
+    test(::math::dot(u_plain, v) == ::math::dot(u, v));
+} // <-- test_kernels<Real>()
+
+const UnitTest kernels_f32 = [] { test_kernels<f32>(); }; // <-- kernels_f32
+const UnitTest kernels_f64 = [] { test_kernels<f64>(); }; // <-- kernels_f64
+
 } // <-- namespace test::math::dot
@@ -0,0 +1,48 @@
+import test_utils;
+
+namespace test::math::elements {
+
+const UnitTest apply{
+    "apply", [] {
+        namespace rng = utils::random::generators;
+
+        // Overlapping 3x3 blocks along a chain of 10 unknowns
+        static constexpr uz n = 10;
+        static constexpr uz elements = n - 2;
+        ::math::ElementBlocks<f64, 3> blocks(elements);
+        ::math::CSR<f64>::Builder builder(n, n);
+
+        auto gen = rng::normal<f64>().begin();
+        for (uz e : range(0uz, elements)) {
+            blocks.get_indices(e) = { e + 2, e, e + 1 };
+            const auto b = blocks.block(e);
+            for (uz i : range(0uz, 3uz)) {
+                for (uz j : range(0uz, 3uz)) {
+                    b[i, j] = *++gen;
+                    builder.add(
+                        blocks.get_indices(e)[i], blocks.get_indices(e)[j],
+                        b[i, j]
+                    );
+                }
+            }
+        }
+        const auto A = builder.build();
+
+        const auto x = std::views::take(rng::normal<f64>(), n)
+                     | std::ranges::to<std::vector<f64>>();
+
+        std::vector<f64> y(n, 0);
+        for (uz e : range(0uz, elements)) blocks.apply(e, x, y);
+        test(all_close(y, ::math::matvec(A, x), 1e-12));
+
+        // Scaled, local
+        std::ranges::fill(y, 0);
+        blocks.apply(3, x, y, -2.0);
+        const auto local = blocks.apply_local(3, x);
+        for (auto [ idx, v ] : std::views::zip(blocks.get_indices(3), local)) {
+            test(y[idx] == -2.0 * v);
+        }
+    }
+}; // <-- apply
+
+} // <-- namespace test::math::elements
@@ -58,6 +58,297 @@ const UnitTest test_20x20{
     }
 }; // <-- 20x20
 
+const UnitTest test_restart{
+    "restart", [] {
+        namespace rng = utils::random::generators;
+
+        static constexpr uz n = 200;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 3.0);
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.5);
+        }
+        const auto A = builder.build();
+
+        const ::math::gmres::Options<f64> r_opt{
+            .max_iters = 1000, .tol = 1e-10, .restart = 10
+        };
+        ::math::gmres::Workspace<f64> ws{};
+
+        for (uz _ : range(0uz, 2uz)) {
+            const auto x0 = std::views::take(rng::normal<f64>(), n)
+                          | std::ranges::to<std::vector<f64>>();
+            const auto b0 = ::math::matvec(A, x0);
+
+            std::vector<f64> x(n, 0);
+            test(::math::gmres::solve(A, b0, x, ws, r_opt));
+            test(ws.iterations > r_opt.restart);
+            test(ws.residual <= r_opt.tol);
+            test(ws.Q.size() == n * (r_opt.restart + 1));
+
+            const auto b = ::math::matvec(A, x);
+            const auto atol = std::ranges::max(b0) * 1e-8;
+            for (auto [ bi, b0i ] : std::views::zip(b, b0)) {
+                test(std::abs(bi - b0i) <= atol);
+            }
+        }
+
+        // Not enough cycles
+        std::vector<f64> x(n, 0);
+        test(!::math::gmres::solve(
+            A, ::math::matvec(A, std::vector<f64>(n, 1)), x, ws,
+            { .max_iters = 1000, .tol = 1e-10, .restart = 2, .max_restarts = 1 }
+        ));
+        test(ws.iterations == 4);
+    }
+}; // <-- restart
+
+const UnitTest test_block{
+    "block", [] {
+        namespace rng = utils::random::generators;
+
+        static constexpr uz n = 200;
+        static constexpr uz k = 5;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 3.0);
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.5);
+        }
+        const auto A = builder.build();
+
+        // Row-major block of right-hand sides, one of them zero
+        const auto X0 = std::views::take(rng::normal<f64>(), n * k)
+                      | std::ranges::to<std::vector<f64>>();
+        std::vector<f64> B(n * k, 0);
+        for (uz r : range(0uz, k - 1)) {
+            ::math::matvec(
+                A,
+                std::span{ X0 }.subspan(r * n, n),
+                std::span{ B }.subspan(r * n, n)
+            );
+        }
+
+        const ::math::gmres::Options<f64> b_opt{
+            .max_iters = 1000, .tol = 1e-10, .restart = 10
+        };
+        ::math::gmres::BlockWorkspace<f64> ws{};
+        ::math::gmres::Workspace<f64> single_ws{};
+        for (auto side : {
+            ::math::gmres::Side::left, ::math::gmres::Side::right
+        }) {
+            auto opt = b_opt;
+            opt.side = side;
+
+            const ::math::precond::Jacobi<f64> jacobi{ A };
+
+            // Counts the single-vector preconditioner applications
+            struct Counting {
+                const ::math::precond::Jacobi<f64>& pc;
+                uz& applies;
+
+                void apply(
+                    std::span<const f64> in, std::span<f64> out
+                ) const {
+                    ++this->applies;
+                    this->pc.apply(in, out);
+                }
+            }; // <-- struct Counting
+
+            uz applies = 0;
+            std::vector<f64> X(n * k, 0);
+            test(::math::gmres::solve_block(
+                A, B, X, k, ws, Counting{ jacobi, applies }, opt
+            ));
+            test(ws.iterations[k - 1] == 0);
+
+            // The zero RHS is only preconditioned for its initial norm
+            uz nonzero_applies = 0;
+            std::vector<f64> X_nonzero(n * (k - 1), 0);
+            ::math::gmres::BlockWorkspace<f64> nonzero_ws{};
+            test(::math::gmres::solve_block(
+                A, std::span{ B }.first(n * (k - 1)), X_nonzero, k - 1,
+                nonzero_ws, Counting{ jacobi, nonzero_applies }, opt
+            ));
+            const bool left = side == ::math::gmres::Side::left;
+            test(applies == nonzero_applies + (left ? 1 : 0));
+
+            for (uz r : range(0uz, k)) {
+                const std::span b{ B.data() + r * n, n };
+                std::vector<f64> x(n, 0);
+                test(::math::gmres::solve(A, b, x, single_ws, jacobi, opt));
+                test(
+                    std::max(single_ws.iterations, ws.iterations[r])
+                    - std::min(single_ws.iterations, ws.iterations[r]) <= 1
+                );
+
+                const std::span x_r{ X.data() + r * n, n };
+                for (auto [ xi, xri ] : std::views::zip(x, x_r)) {
+                    test(std::abs(xi - xri) <= 1e-8);
+                }
+            }
+        }
+
+        // No `restart`: the basis stays bounded instead of `max_iters` wide
+        std::vector<f64> X(n * k, 0);
+        test(::math::gmres::solve_block(
+            A, B, X, k, ws, { .max_iters = 1000, .tol = 1e-10 }
+        ));
+        test(ws.Q.size() == (::math::gmres::block_restart + 1) * n * k);
+    }
+}; // <-- block
+
+const UnitTest test_mixed{
+    "mixed", [] {
+        namespace rng = utils::random::generators;
+
+        static constexpr uz n = 300;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 4.0);
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.5);
+        }
+        const auto A = builder.build();
+        const auto A_low = ::math::convert<f32>(A);
+        const ::math::precond::Jacobi<f32> jacobi{ A_low };
+
+        const auto x0 = std::views::take(rng::normal<f64>(), n)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b = ::math::matvec(A, x0);
+
+        // Far below what a plain `f32` solve reaches
+        const ::math::gmres::Options<f64> m_opt{
+            .max_iters = 1000, .tol = 1e-12, .restart = 20
+        };
+        ::math::gmres::MixedWorkspace<f64, f32> ws{};
+        std::vector<f64> x(n, 0);
+        test(::math::gmres::solve_mixed(A, A_low, b, x, ws, jacobi, m_opt));
+        test(ws.residual <= m_opt.tol);
+        test(ws.refinements > 1);
+
+        f64 max_diff = 0;
+        for (auto [ xi, x0i ] : std::views::zip(x, x0)) {
+            max_diff = std::max(max_diff, std::abs(xi - x0i));
+        }
+        test(max_diff <= 1e-10);
+    }
+}; // <-- mixed
+
+const UnitTest test_ortho{
+    "ortho", [] {
+        namespace rng = utils::random::generators;
+        using ::math::gmres::Ortho;
+
+        static constexpr uz n = 400;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 2.5 + 0.01 * static_cast<f64>(i % 7));
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.2);
+        }
+        const auto A = builder.build();
+        const ::math::precond::Jacobi<f64> jacobi{ A };
+
+        const auto x0 = std::views::take(rng::normal<f64>(), n)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b = ::math::matvec(A, x0);
+
+        const ::math::gmres::Options<f64> base{
+            .max_iters = 1000, .tol = 1e-10, .restart = 30
+        };
+        ::math::gmres::Workspace<f64> ws{};
+
+        const auto run = [&] (Ortho ortho, uz s_step) {
+            auto opt = base;
+            opt.ortho  = ortho;
+            opt.s_step = s_step;
+
+            std::vector<f64> x(n, 0);
+            test(::math::gmres::solve(A, b, x, ws, jacobi, opt));
+
+            f64 max_diff = 0;
+            for (auto [ xi, x0i ] : std::views::zip(x, x0)) {
+                max_diff = std::max(max_diff, std::abs(xi - x0i));
+            }
+            test(max_diff <= 1e-7);
+            return ws.iterations;
+        }; // <-- run(ortho, s_step)
+
+        const auto mgs  = run(Ortho::mgs, 1);
+        const auto cgs2 = run(Ortho::cgs2, 1);
+        test(std::max(mgs, cgs2) - std::min(mgs, cgs2) <= 1);
+
+        // The block may be cut short, but never needs many more iterations
+        for (uz s : { 2, 4 }) {
+            const auto s_iters = run(Ortho::mgs, s);
+            std::println(
+                "    - s = {}: {} iterations (mgs {})", s, s_iters, mgs
+            );
+            test(s_iters <= mgs + mgs / 4 + 2);
+        }
+    }
+}; // <-- ortho
+
+const UnitTest test_recycle{
+    "recycle", [] {
+        namespace rng = utils::random::generators;
+
+        // 1D Laplacian, slow for restarted GMRES due to its small
+        // eigenvalues, i.e. what the recycled space deflates
+        static constexpr uz n = 300;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 2.0);
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.0);
+        }
+        const auto A = builder.build();
+
+        auto r_opt = ::math::gmres::Options<f64>{
+            .max_iters = 5000, .tol = 1e-9, .restart = 20
+        };
+        ::math::gmres::Workspace<f64> plain_ws{};
+        ::math::gmres::Workspace<f64> rec_ws{};
+
+        uz plain_last = 0;
+        uz rec_last   = 0;
+        for (uz _ : range(0uz, 4uz)) {
+            const auto x0 = std::views::take(rng::normal<f64>(), n)
+                          | std::ranges::to<std::vector<f64>>();
+            const auto b = ::math::matvec(A, x0);
+
+            r_opt.recycle = 0;
+            std::vector<f64> x(n, 0);
+            test(::math::gmres::solve(A, b, x, plain_ws, r_opt));
+            plain_last = plain_ws.iterations;
+
+            r_opt.recycle = 8;
+            std::vector<f64> x_rec(n, 0);
+            test(::math::gmres::solve(A, b, x_rec, rec_ws, r_opt));
+            rec_last = rec_ws.iterations;
+            test(rec_ws.recycled.k == 8);
+
+            const auto r = ::math::matvec(A, x_rec);
+            f64 max_diff = 0;
+            for (auto [ ri, bi ] : std::views::zip(r, b)) {
+                max_diff = std::max(max_diff, std::abs(ri - bi));
+            }
+            test(max_diff <= 1e-7 * std::ranges::max(b));
+        }
+
+        std::println(
+            "    - last solve: {} iterations (plain {})", rec_last, plain_last
+        );
+        test(rec_last < plain_last);
+
+        // A new operator needs a new space
+        rec_ws.recycled.clear();
+        test(rec_ws.recycled.k == 0);
+    }
+}; // <-- recycle
+
 #ifdef NDEBUG
 const ::math::gmres::Options<f64> big_opt{ .max_iters = 10000, .tol = 1e-7 };
 
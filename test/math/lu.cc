@@ -0,0 +1,61 @@
+import test_utils;
+
+namespace test::math::lu {
+
+const UnitTest test_2x2{
+    "2x2", [] {
+        ::math::CSR<f64>::Builder builder(2, 2);
+        builder.add(0, 0, 1.0);
+        builder.add(0, 1, 3.0);
+        builder.add(1, 0, -1.0);
+        builder.add(1, 1, 2.0);
+        const auto A = builder.build();
+
+        ::math::lu::Factor<f64> lu{ A };
+
+        const std::vector b{ 1.0, 0.0 };
+        std::vector<f64> x(2);
+        lu.solve(b, x);
+        test(all_close(x, std::vector{ 0.4, 0.2 }));
+    }
+}; // <-- 2x2
+
+const UnitTest grid{
+    "grid", [] {
+        namespace rng = utils::random::generators;
+
+        // Non-symmetric 5-point stencil on a 30x30 grid
+        static constexpr uz n = 30;
+        ::math::CSR<f64>::Builder builder(n * n, n * n);
+        auto gen = rng::normal<f64>(0.0, 0.1).begin();
+        for (uz i : range(0uz, n)) {
+            for (uz j : range(0uz, n)) {
+                const auto row = i * n + j;
+                builder.add(row, row, 4.0);
+                if (i > 0)     builder.add(row, row - n, -1.0 + *++gen);
+                if (i + 1 < n) builder.add(row, row + n, -1.0 + *++gen);
+                if (j > 0)     builder.add(row, row - 1, -1.0 + *++gen);
+                if (j + 1 < n) builder.add(row, row + 1, -1.0 + *++gen);
+            }
+        }
+        auto A = builder.build();
+
+        const auto x0 = std::views::take(rng::normal<f64>(), n * n)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b = ::math::matvec(A, x0);
+
+        ::math::lu::Factor<f64> lu{ A };
+        std::vector<f64> x(n * n);
+        lu.solve(b, x);
+        test(all_close(x, x0, 1e-9));
+
+        // Numeric refactorization on the same pattern
+        for (uz row : range(0uz, n * n)) A[row, row] = 8.0;
+        lu.factorize(A);
+        const auto b2 = ::math::matvec(A, x0);
+        lu.solve(b2, x);
+        test(all_close(x, x0, 1e-9));
+    }
+}; // <-- grid
+
+} // <-- namespace test::math::lu
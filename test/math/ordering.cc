@@ -0,0 +1,32 @@
+import test_utils;
+
+namespace test::math::ordering {
+
+const UnitTest nested_dissection{
+    "nested_dissection", [] {
+        // Path graph 0 - 1 - ... - (n - 1)
+        static constexpr uz n = 200;
+        ::math::CSR<f32>::Builder builder(n, n);
+        for (uz i : range(0uz, n - 1)) {
+            builder.add(i, i + 1, 1);
+            builder.add(i + 1, i, 1);
+        }
+        const auto g = ::math::ordering::Graph::symmetric(builder.build());
+
+        test(g.size() == n);
+        test(g.neighbors(0).size() == 1);
+        test(g.neighbors(1).size() == 2);
+
+        const auto perm = ::math::ordering::nested_dissection(g, 8);
+        test(set_equal(perm, std::views::iota(0uz, n) | std::ranges::to<std::set>()));
+
+        const auto iperm = ::math::ordering::inverse(perm);
+        for (uz i : range(0uz, n)) test(iperm[perm[i]] == i);
+
+        // The top-level separator of a path is a single vertex, ordered last
+        const auto sep = perm.back();
+        test(sep > 0 && sep < n - 1);
+    }
+}; // <-- nested_dissection
+
+} // <-- namespace test::math::ordering
@@ -0,0 +1,86 @@
+import test_utils;
+
+namespace test::math::precond {
+
+namespace pc = ::math::precond;
+
+// Non-symmetric 5-point stencil on a 30x30 grid
+const auto A = [] {
+    static constexpr uz n = 30;
+    ::math::CSR<f64>::Builder builder(n * n, n * n);
+    for (uz i : range(0uz, n)) {
+        for (uz j : range(0uz, n)) {
+            const auto row = i * n + j;
+            builder.add(row, row, 4.2);
+            if (i > 0)     builder.add(row, row - n, -1.2);
+            if (i + 1 < n) builder.add(row, row + n, -0.8);
+            if (j > 0)     builder.add(row, row - 1, -1.1);
+            if (j + 1 < n) builder.add(row, row + 1, -0.9);
+        }
+    }
+    return builder.build();
+} (); // <-- A
+
+// Solves with `p` on both sides, returns the larger iteration count
+template <typename P>
+uz check(const P& p) {
+    namespace rng = utils::random::generators;
+
+    const auto n = A.get_rows();
+    const auto x0 = std::views::take(rng::normal<f64>(), n)
+                  | std::ranges::to<std::vector<f64>>();
+    const auto b0 = ::math::matvec(A, x0);
+
+    ::math::gmres::Workspace<f64> ws{};
+    uz iters = 0;
+    for (auto side : { ::math::gmres::Side::left, ::math::gmres::Side::right }) {
+        std::vector<f64> x(n, 0);
+        test(::math::gmres::solve(
+            A, b0, x, ws, p,
+            { .max_iters = 1000, .tol = 1e-10, .restart = 30, .side = side }
+        ));
+        test(all_close(x, x0, 1e-6));
+        iters = std::max(iters, ws.iterations);
+    }
+    return iters;
+} // <-- check(p)
+
+const UnitTest preconditioners{
+    "preconditioners", [] {
+        const auto none   = check(pc::Identity{});
+        const auto jacobi = check(pc::Jacobi<f64>{ A });
+        const auto ilu0   = check(pc::ILU0<f64>{ A });
+        const auto ssor   = check(pc::SSOR<f64>{ A, 1.2 });
+
+        std::println(
+            "    - iterations: none={} jacobi={} ilu0={} ssor={}",
+            none, jacobi, ilu0, ssor
+        );
+
+        test(ilu0 < none);
+        test(ssor < none);
+    }
+}; // <-- preconditioners
+
+const UnitTest ilu0_exact{
+    "ilu0_exact", [] {
+        // No fill for a tridiagonal matrix: ILU(0) is the exact LU
+        static constexpr uz n = 50;
+        ::math::CSR<f64>::Builder builder(n, n);
+        for (uz i : range(0uz, n)) {
+            builder.add(i, i, 3.0);
+            if (i > 0)     builder.add(i, i - 1, -1.0);
+            if (i + 1 < n) builder.add(i, i + 1, -1.5);
+        }
+        const auto T = builder.build();
+
+        const std::vector<f64> x0(n, 1);
+        const auto b = ::math::matvec(T, x0);
+
+        std::vector<f64> x(n);
+        pc::ILU0<f64>{ T }.apply(b, x);
+        test(all_close(x, x0, 1e-10));
+    }
+}; // <-- ilu0_exact
+
+} // <-- namespace test::math::precond
@@ -0,0 +1,97 @@
+import test_utils;
+
+namespace test::math::sellcs {
+
+namespace rng = utils::random::generators;
+
+template <typename R>
+R max_diff(const std::vector<R>& a, const std::vector<R>& b) {
+    R ret{};
+    for (auto [ ae, be ] : std::views::zip(a, b)) {
+        ret = std::max(ret, std::abs(ae - be));
+    }
+    return ret;
+} // <-- max_diff<R>(a, b)
+
+// Rows of 0 to 6 entries around the diagonal, dominant diagonal
+template <typename R>
+::math::CSR<R> make_matrix(uz n) {
+    typename ::math::CSR<R>::Builder builder(n, n);
+    auto gen = rng::normal<R>(-1.0, 1.0).begin();
+    for (uz i : range(0uz, n)) {
+        if (i % 11 == 5) continue; // Empty row
+
+        builder.add(i, i, 10);
+        for (uz d : range(1uz, 1 + i % 4)) {
+            if (i >= d)    builder.add(i, i - d, *++gen);
+            if (i + d < n) builder.add(i, i + d, *++gen);
+        }
+    }
+    return builder.build();
+} // <-- make_matrix<R>(n)
+
+template <typename R, typename Index>
+void check_matvec(uz n, uz sigma) {
+    const auto csr = make_matrix<R>(n);
+    const ::math::SellCS<R, Index> sell(csr, sigma);
+
+    test(sell.get_rows() == n && sell.get_cols() == n);
+    test(sell.get_stored() % sell.chunk == 0);
+
+    const auto x = std::views::take(rng::normal<R>(), n)
+                 | std::ranges::to<std::vector<R>>();
+
+    std::vector<R> ref(n, 1);
+    std::vector<R> out(n, 1);
+    ::math::matvec(csr, x, ref, -2);
+    ::math::matvec(sell, x, out, -2);
+    test(max_diff(out, ref) <= 1e-4);
+
+    // Interleaved block of 3 vectors
+    static constexpr uz k = 3;
+    const auto xs = std::views::take(rng::normal<R>(), n * k)
+                  | std::ranges::to<std::vector<R>>();
+    std::vector<R> ref_k(n * k, 0);
+    std::vector<R> out_k(n * k, 0);
+    ::math::matvec_block(csr, xs, ref_k, k);
+    ::math::matvec_block(sell, xs, out_k, k);
+    test(std::ranges::equal(out_k, ref_k));
+} // <-- check_matvec<R, Index>(n, sigma)
+
+const UnitTest matvec{
+    "matvec", [] {
+        for (uz n : { 1uz, 7uz, 64uz, 333uz }) {
+            for (uz sigma : { 1uz, 32uz, 1000uz }) {
+                check_matvec<f32, u32>(n, sigma);
+                check_matvec<f64, u32>(n, sigma);
+                check_matvec<f64, u16>(n, sigma);
+            }
+        }
+    }
+}; // <-- matvec
+
+// Sorting within windows can only remove padding
+const UnitTest sorting{
+    "sorting", [] {
+        const auto csr = make_matrix<f64>(500);
+        const ::math::SellCS<f64> plain(csr);
+        const ::math::SellCS<f64> sorted(csr, 64);
+        test(sorted.get_stored() <= plain.get_stored());
+    }
+}; // <-- sorting
+
+const UnitTest gmres{
+    "gmres", [] {
+        const auto csr = make_matrix<f64>(200);
+        const ::math::SellCS<f64> sell(csr, 16);
+
+        const auto x0 = std::views::take(rng::normal<f64>(), 200)
+                      | std::ranges::to<std::vector<f64>>();
+        const auto b = ::math::matvec(csr, x0);
+
+        const auto x = ::math::gmres::solve(sell, b);
+        test(max_diff(x, x0) <= 1e-5);
+    }
+}; // <-- gmres
+
+} // <-- namespace test::math::sellcs
@@ -70,6 +70,124 @@ const UnitTest saveload{
     }
 }; // <-- saveload
 
+const UnitTest binary_saveload{
+    "binary_saveload", [] {
+        struct FileDeleter {
+            const std::filesystem::path tp{ "mesh.bin" };
+            ~FileDeleter() {
+                std::filesystem::remove(tp);
+            }
+        } tp {};
+
+        dxx::assert::always(!std::filesystem::exists(tp.tp));
+
+        const auto check = [] (const Mesh& m1) {
+            test(std::ranges::equal(m.points, m1.points));
+            test(std::ranges::equal(m.edges, m1.edges));
+            test(std::ranges::equal(m.cells, m1.cells));
+        }; // <-- check(m1)
+
+        ::mesh::save(m, tp.tp);
+        check(::mesh::binary::read<f32>(std::ifstream{ tp.tp }));
+        check(::mesh::load<f32>(tp.tp));
+        {
+            const ::mesh::binary::Mapped<f32> mapped{ tp.tp };
+            test(mapped.get_header().cells == m.cells.size());
+            test(std::ranges::equal(mapped.edges(), m.edges));
+            check(mapped.to_triangular());
+        }
+
+        // Wrong real type
+        bool thrown = false;
+        try {
+            const ::mesh::binary::Mapped<f64> mapped{ tp.tp };
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        test(thrown);
+
+        // Flipped bit in the last cell
+        {
+            std::fstream f{
+                tp.tp, std::ios::in | std::ios::out | std::ios::binary
+            };
+            f.seekg(-1, std::ios::end);
+            const auto c = static_cast<char>(f.get());
+            f.seekp(-1, std::ios::end);
+            f.put(static_cast<char>(c ^ 1));
+        }
+        thrown = false;
+        try {
+            const ::mesh::binary::Mapped<f32> mapped{ tp.tp };
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        test(thrown);
+        {
+            // Unchecked, the header is still valid
+            const ::mesh::binary::Mapped<f32> mapped{ tp.tp, false };
+            test(std::ranges::equal(mapped.points(), m.points));
+        }
+
+        // Text files still load
+        ::mesh::save(m, tp.tp, ::mesh::Format::text);
+        check(::mesh::load<f32>(tp.tp));
+
+        // Unwritable path
+        thrown = false;
+        try {
+            ::mesh::save(m, tp.tp / "mesh.bin");
+        } catch (const utils::Error&) {
+            thrown = true;
+        }
+        test(thrown);
+    }
+}; // <-- binary_saveload
+
+const UnitTest binary_layout{
+    "binary_layout", [] {
+        namespace binary = ::mesh::binary;
+
+        std::ostringstream out;
+        binary::write(m, out);
+        const auto bytes = std::move(out).str();
+
+        binary::Header h;
+        std::memcpy(&h, bytes.data(), sizeof(h));
+        const auto with_header = [&bytes] (binary::Header c_h, uz gap) {
+            c_h.header_checksum = binary::checksum(std::span{
+                reinterpret_cast<const std::byte*>(&c_h),
+                sizeof(c_h) - sizeof(c_h.header_checksum)
+            });
+            auto ret = bytes;
+            std::memcpy(ret.data(), &c_h, sizeof(c_h));
+            ret.insert(c_h.cells_offset - gap, gap, '\0');
+            return ret;
+        }; // <-- with_header(c_h, gap)
+
+        // A wider gap than the alignment before the cells
+        auto wide = h;
+        wide.cells_offset += 4 * 64;
+        const auto read = binary::read<f32>(
+            std::istringstream{ with_header(wide, 4 * 64) }
+        );
+        test(std::ranges::equal(read.cells, m.cells));
+
+        // Cells before the edges
+        auto swapped = h;
+        std::swap(swapped.edges_offset, swapped.cells_offset);
+        bool thrown = false;
+        try {
+            std::ignore = binary::read<f32>(
+                std::istringstream{ with_header(swapped, 0) }
+            );
+        } catch (const utils::Error&) {
+            thrown = true;
+        }
+        test(thrown);
+    }
+}; // <-- binary_layout
+
 const UnitTest direct{
     "direct", [] {
         auto mc = m;
@@ -84,4 +202,157 @@ const UnitTest direct{
     }
 }; // <-- direct
 
+const UnitTest from_cells{
+    "from_cells", [] {
+        using Mesh64 = ::mesh::Triangular<f64>;
+
+        static constexpr uz n_x = 7;
+        static constexpr uz n_y = 5;
+        const auto rect = ::mesh::gen_rect<f64>(n_x, n_y, 7, 5).value();
+        test(rect.is_valid());
+
+        // The quadratic construction `gen_rect` used to do, edges looked up
+        // among all the previous ones
+        Mesh64 ref{ .points = rect.points, .edges = {}, .cells = {} };
+        for (const auto& cell : rect.cells) {
+            auto& c = ref.cells.emplace_back();
+            c.points = cell.points;
+
+            const auto c_idx = ref.cells.size() - 1;
+            const auto push_edge = [&ref, c_idx] (uz p1, uz p2) -> uz {
+                for (auto [ e_idx, e ] : enumerate(ref.edges)) {
+                    if (std::minmax(e.points[0], e.points[1])
+                        == std::minmax(p1, p2)) {
+                        e.cells[1] = c_idx;
+                        return e_idx;
+                    }
+                }
+                ref.edges.push_back({
+                    .points = { p1, p2 }, .cells = { c_idx, ::mesh::no_cell }
+                });
+                return ref.edges.size() - 1;
+            }; // <-- push_edge(p1, p2)
+
+            c.edges = {
+                push_edge(c.points[0], c.points[1]),
+                push_edge(c.points[2], c.points[1]),
+                push_edge(c.points[0], c.points[2]),
+            };
+        }
+        ref.direct();
+
+        test(std::ranges::equal(rect.edges, ref.edges));
+        test(std::ranges::equal(rect.cells, ref.cells));
+
+        // Three cells on one edge
+        const std::vector<std::array<uz, 3>> fan{
+            { 0, 1, 2 }, { 0, 1, 3 }, { 0, 1, 4 },
+        };
+        bool threw = false;
+        try {
+            std::ignore = Mesh64::from_cells(
+                { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 0, -1 }, { 1, 1 } }, fan
+            );
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        test(threw);
+    }
+}; // <-- from_cells
+
+const UnitTest refine{
+    "refine", [] {
+        const auto coarse = ::mesh::gen_rect<f64>(3, 2, 3, 2).value();
+        const auto levels = ::mesh::hierarchy(coarse, 3);
+        test(levels.size() == 3);
+
+        for (auto l : range(1uz, levels.size())) {
+            const auto& prev = levels[l - 1];
+            const auto& fine = levels[l];
+            test(fine.is_valid());
+
+            test(fine.points.size() == prev.points.size() + prev.edges.size());
+            test(fine.edges.size() == 2 * prev.edges.size()
+                                      + 3 * prev.cells.size());
+            test(fine.cells.size() == 4 * prev.cells.size());
+
+            // Children of a cell are consecutive and split its area evenly
+            for (auto [ c_idx, cell ] : enumerate(prev.cells)) {
+                for (auto k : range(0uz, 4uz)) {
+                    test(is_close(
+                        fine.cell_measure(4 * c_idx + k),
+                        prev.cell_measure(c_idx) / 4,
+                        1e-12
+                    ));
+                }
+            }
+
+            const auto boundary = [] (const auto& m) {
+                return std::ranges::count_if(
+                    m.edges, [] (const auto& e) { return e.is_boundary(); }
+                );
+            }; // <-- boundary(m)
+            test(boundary(fine) == 2 * boundary(prev));
+        }
+    }
+}; // <-- refine
+
+const UnitTest reorder{
+    "reorder", [] {
+        using Mesh = ::mesh::Triangular<f64>;
+
+        // Randomly renumbered rectangle
+        const auto shuffled = [] {
+            auto ret = ::mesh::gen_rect<f64>(24, 12, 2, 1).value();
+            ::mesh::permute(ret, ::mesh::shuffling(ret, std::mt19937{ 42 }));
+            return ret;
+        } (); // <-- shuffled
+        test(shuffled.is_valid());
+
+        // Total edge index spread of the cells, the distance of a step's
+        // gathers (a space-filling curve does not bound the widest one)
+        const auto spread = [] (const Mesh& m) {
+            uz ret = 0;
+            for (const auto& cell : m.cells) {
+                const auto [ lo, hi ] = std::ranges::minmax(cell.edges);
+                ret += hi - lo;
+            }
+            return ret;
+        }; // <-- spread(m)
+
+        for (auto order : { ::mesh::Order::rcm, ::mesh::Order::hilbert }) {
+            auto m = shuffled;
+            const auto perm = ::mesh::reorder(m, order);
+            test(m.is_valid());
+
+            std::println(
+                "    - order {}: edge spread {} (shuffled {})",
+                std::to_underlying(order), spread(m), spread(shuffled)
+            );
+            test(spread(m) * 4 < spread(shuffled));
+
+            // Same geometry and orientation under the new numbering
+            for (auto [ c_new, c_old ] : enumerate(perm.cells)) {
+                test(m.cell_measure(c_new) == shuffled.cell_measure(c_old));
+            }
+            for (auto [ e_new, e_old ] : enumerate(perm.edges)) {
+                test(m.get_edge_dir(e_new) == shuffled.get_edge_dir(e_old));
+
+                const auto& old_cells = shuffled.edges[e_old].cells;
+                const auto& new_cells = m.edges[e_new].cells;
+                for (auto [ n, o ] : std::views::zip(new_cells, old_cells)) {
+                    test((n == ::mesh::no_cell) == (o == ::mesh::no_cell));
+                    if (n != ::mesh::no_cell) test(perm.cells[n] == o);
+                }
+            }
+
+            const auto ids = range(0uz, m.cells.size())
+                           | std::ranges::to<std::vector>();
+            const auto moved = ::mesh::to_new(perm.cells, ids);
+            test(std::ranges::equal(moved, perm.cells));
+            test(std::ranges::equal(::mesh::to_old(perm.cells, moved), ids));
+        }
+    }
+}; // <-- reorder
+
 } // <-- namespace test::mesh
@@ -4,10 +4,11 @@ namespace test::mhfe::lmhfe {
 
 using Real = f32;
 
-const auto prob = [] {
-    ::mhfe::Problem<Real> prob{};
+template <typename R>
+::mhfe::Problem<R> make_problem(uz n_x, uz n_y) {
+    ::mhfe::Problem<R> prob{};
     prob.tau = 0.1;
-    prob.mesh = mesh::gen_rect<Real>(40, 20, 20, 10).value().direct();
+    prob.mesh = mesh::gen_rect<R>(n_x, n_y, 20, 10).value().direct();
     prob.a.resize(prob.mesh.cells.size(), 1);
     prob.c.resize(prob.mesh.cells.size(), 1);
 
@@ -41,7 +42,9 @@ const auto prob = [] {
     prob.cells  = prob.mesh.cells.size();
 
     return prob;
-} (); // <-- prob
+} // <-- make_problem<R>(n_x, n_y)
+
+const auto prob = make_problem<Real>(40, 20);
 
 const UnitTest lmhfe{
     "lmhfe", [] {
@@ -78,6 +81,352 @@ const UnitTest lmhfe{
     }
 }; // <-- lmhfe
 
+const UnitTest lmhfe_direct{
+    "lmhfe_direct", [] {
+        ::mhfe::LMHFE gmres(prob, 1e-6f);
+        ::mhfe::LMHFE direct(
+            prob, 1e-6f, { .solver = ::mhfe::LinearSolver::direct }
+        );
+
+        const auto time = utils::timeit(
+            [&] {
+                for (uz _ : range(0uz, 10uz)) {
+                    direct.step();
+                }
+            }
+        );
+        std::println("    - simulated 10 steps in {}ms", time.count());
+
+        for (uz _ : range(0uz, 10uz)) {
+            gmres.step();
+        }
+
+        const auto& ref = gmres.get_solution();
+        const auto& sol = direct.get_solution();
+        test(all_close_scaled(ref, sol, 1e-4f));
+    }
+}; // <-- lmhfe_direct
+
+const UnitTest lmhfe_precond{
+    "lmhfe_precond", [] {
+        using ::mhfe::Preconditioner;
+
+        ::mhfe::LMHFE plain(prob, 1e-6f);
+        plain.step();
+
+        for (auto p : {
+            Preconditioner::jacobi, Preconditioner::ilu0, Preconditioner::ssor
+        }) {
+            ::mhfe::LMHFE solver(prob, 1e-6f, { .precond = p });
+            solver.step();
+
+            std::println(
+                "    - preconditioner {}: {} iterations (unpreconditioned {})",
+                std::to_underlying(p),
+                solver.get_iterations(),
+                plain.get_iterations()
+            );
+
+            test(all_close_scaled(
+                plain.get_solution(), solver.get_solution(), 1e-4f
+            ));
+        }
+    }
+}; // <-- lmhfe_precond
+
+const UnitTest lmhfe_mixed{
+    "lmhfe_mixed", [] {
+        using R = f64;
+
+        const auto prob = make_problem<R>(40, 20);
+
+        ::mhfe::LMHFE<R> plain(prob, 1e-10);
+        ::mhfe::LMHFE<R> mixed(
+            prob, 1e-10,
+            { .mixed_precision = true, .precond = ::mhfe::Preconditioner::ilu0 }
+        );
+        for (uz _ : range(0uz, 3uz)) {
+            plain.step();
+            mixed.step();
+        }
+
+        std::println(
+            "    - mixed: {} inner iterations (plain {})",
+            mixed.get_iterations(),
+            plain.get_iterations()
+        );
+
+        test(all_close_scaled(
+            plain.get_solution(), mixed.get_solution(), 1e-8
+        ));
+    }
+}; // <-- lmhfe_mixed
+
+const UnitTest lmhfe_recycle{
+    "lmhfe_recycle", [] {
+        using R = f64;
+
+        const auto prob = make_problem<R>(40, 20);
+
+        ::mhfe::Options<R> options{
+            .gmres = { .max_iters = 2000, .restart = 20 }
+        };
+        ::mhfe::LMHFE<R> plain(prob, 1e-10, options);
+        options.gmres.recycle = 8;
+        ::mhfe::LMHFE<R> recycled(prob, 1e-10, options);
+
+        static constexpr uz steps = 8;
+        for (uz _ : range(0uz, steps)) {
+            plain.step();
+            recycled.step();
+        }
+
+        const auto& p_hist = plain.get_iteration_history();
+        const auto& r_hist = recycled.get_iteration_history();
+        test(p_hist.size() == steps);
+        test(r_hist.size() == steps);
+        std::println(
+            "    - iterations per step: {} (plain {})", r_hist, p_hist
+        );
+
+        // The first step has nothing to recycle yet
+        const auto later = [] (const auto& h) {
+            return std::ranges::fold_left(
+                h | std::views::drop(1), 0uz, std::plus{}
+            );
+        }; // <-- later(h)
+        test(later(r_hist) < later(p_hist));
+
+        test(all_close_scaled(
+            plain.get_solution(), recycled.get_solution(), 1e-7
+        ));
+    }
+}; // <-- lmhfe_recycle
+
+const UnitTest lmhfe_cg{
+    "lmhfe_cg", [] {
+        using R = f64;
+        using ::mhfe::LinearSolver;
+
+        const auto prob = make_problem<R>(40, 20);
+
+        ::mhfe::LMHFE<R> plain(prob, 1e-10);
+        // Same GMRES solve of the eliminated system
+        ::mhfe::LMHFE<R> symmetric(
+            prob, 1e-10, { .symmetric_dirichlet = true }
+        );
+        ::mhfe::LMHFE<R> cg(prob, 1e-10, {
+            .solver  = LinearSolver::cg,
+            .cg      = { .max_iters = 2000 },
+            .precond = ::mhfe::Preconditioner::jacobi,
+        });
+        for (uz _ : range(0uz, 3uz)) {
+            plain.step();
+            symmetric.step();
+            cg.step();
+        }
+
+        std::println(
+            "    - cg: {} iterations (gmres {}, gmres eliminated {})",
+            cg.get_iterations(),
+            plain.get_iterations(),
+            symmetric.get_iterations()
+        );
+        test(cg.get_iterations() > 0);
+
+        test(all_close_scaled(
+            plain.get_solution(), symmetric.get_solution(), 1e-7
+        ));
+        test(all_close_scaled(plain.get_solution(), cg.get_solution(), 1e-7));
+    }
+}; // <-- lmhfe_cg
+
+const UnitTest lmhfe_batch{
+    "lmhfe_batch", [] {
+        using R = f64;
+        using ::mhfe::LinearSolver;
+        static constexpr uz K = 4;
+
+        const auto prob = make_problem<R>(40, 20);
+
+        // Scaled and shifted boundary values per scenario
+        std::array<std::vector<R>, K> dirichlet;
+        std::array<std::vector<R>, K> neumann;
+        std::array<::mhfe::Problem<R>, K> probs;
+        std::array<::mhfe::LMHFEBatch<R, K>::Scenario, K> scenarios;
+        for (uz s : range(0uz, K)) {
+            dirichlet[s] = prob.dirichlet;
+            neumann[s]   = prob.neumann;
+            for (auto e_idx : range(0uz, prob.edges)) {
+                dirichlet[s][e_idx] = (s + 1) * prob.dirichlet[e_idx]
+                                      + 0.25 * s * prob.dirichlet_mask[e_idx];
+                neumann[s][e_idx]   = 0.1 * s * prob.neumann_mask[e_idx];
+            }
+
+            probs[s] = prob;
+            probs[s].dirichlet = dirichlet[s];
+            probs[s].neumann   = neumann[s];
+            scenarios[s] = { dirichlet[s], neumann[s] };
+        }
+
+        for (const auto& options : {
+            ::mhfe::Options<R>{ .precond = ::mhfe::Preconditioner::ilu0 },
+            ::mhfe::Options<R>{
+                .solver  = LinearSolver::cg,
+                .cg      = { .max_iters = 2000 },
+                .precond = ::mhfe::Preconditioner::jacobi,
+            },
+            ::mhfe::Options<R>{ .solver = LinearSolver::direct },
+        }) {
+            ::mhfe::LMHFEBatch<R, K> batch(prob, scenarios, 1e-10, options);
+            std::vector<::mhfe::LMHFE<R>> singles;
+            for (const auto& p : probs) singles.emplace_back(p, 1e-10, options);
+
+            for (uz _ : range(0uz, 3uz)) {
+                batch.step();
+                for (auto& single : singles) single.step();
+            }
+            test(batch.get_time() == singles[0].get_time());
+
+            std::println(
+                "    - solver {}: {} batched iterations (single {})",
+                std::to_underlying(options.solver),
+                batch.get_iterations(),
+                singles[K - 1].get_iterations()
+            );
+
+            for (uz s : range(0uz, K)) {
+                const auto& ref = singles[s].get_solution();
+                const auto  sol = batch.get_solution(s);
+                test(sol.size() == ref.size());
+                test(all_close_scaled(ref, sol, 1e-7));
+            }
+        }
+    }
+}; // <-- lmhfe_batch
+
+const UnitTest lmhfe_reordered{
+    "lmhfe_reordered", [] {
+        using R = f64;
+
+        const auto prob = make_problem<R>(20, 10);
+
+        auto reordered = prob;
+        const auto perm = ::mesh::reorder(
+            reordered.mesh, ::mesh::Order::hilbert
+        );
+        reordered.a = ::mesh::to_new(perm.cells, prob.a);
+        reordered.c = ::mesh::to_new(perm.cells, prob.c);
+        reordered.dirichlet = ::mesh::to_new(perm.edges, prob.dirichlet);
+        reordered.dirichlet_mask = ::mesh::to_new(
+            perm.edges, prob.dirichlet_mask
+        );
+        reordered.neumann = ::mesh::to_new(perm.edges, prob.neumann);
+        reordered.neumann_mask = ::mesh::to_new(perm.edges, prob.neumann_mask);
+        test(reordered.is_valid());
+
+        const ::mhfe::Options<R> options{
+            .solver = ::mhfe::LinearSolver::direct
+        };
+        ::mhfe::LMHFE<R> plain(prob, 1e-10, options);
+        ::mhfe::LMHFE<R> solver(reordered, 1e-10, options);
+        for (uz _ : range(0uz, 3uz)) {
+            plain.step();
+            solver.step();
+        }
+
+        const auto back = ::mesh::to_old(perm.cells, solver.get_solution());
+        test(all_close_scaled(plain.get_solution(), back, 1e-10));
+    }
+}; // <-- lmhfe_reordered
+
+const UnitTest update_coefficients{
+    "update_coefficients", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+        const ::mhfe::Options<R> options{
+            .solver = ::mhfe::LinearSolver::direct
+        };
+
+        ::mhfe::LMHFE<R> updated(small, 1e-12, options);
+        for (uz _ : range(0uz, 2uz)) updated.step();
+        const auto state = updated.get_state();
+
+        const std::vector<uz> cells{ 3, 10, 0 };
+        const std::vector<R>  new_a{ 2.0, 0.5, 3.0 };
+        const std::vector<R>  new_c{ 0.5, 1.0, 2.0 };
+        updated.update_coefficients(cells, new_a, new_c);
+        updated.set_tau(0.05);
+
+        // A fresh solver on the changed problem from the same state
+        auto changed = small;
+        for (auto [ c_idx, a, c ] : std::views::zip(cells, new_a, new_c)) {
+            changed.a[c_idx] = a;
+            changed.c[c_idx] = c;
+        }
+        changed.tau = 0.05;
+        ::mhfe::LMHFE<R> fresh(changed, 1e-12, options);
+        fresh.set_state(state);
+
+        for (uz _ : range(0uz, 3uz)) {
+            updated.step();
+            fresh.step();
+        }
+
+        // Localized reassembly sums in the same order as the full one
+        test(std::ranges::equal(updated.get_solution(), fresh.get_solution()));
+        test(std::ranges::equal(updated.get_prob().a, changed.a));
+        test(small.a[3] == 1);
+    }
+}; // <-- update_coefficients
+
+const UnitTest problem_view{
+    "problem_view", [] {
+        using R = f64;
+        using View = ::mhfe::ProblemView<R>;
+
+        const auto owned = make_problem<R>(8, 4);
+
+        // Non-owning views and their copies share everything
+        const auto view = View::of(owned);
+        const auto copy = view;
+        test(&copy.mesh == &owned.mesh);
+        test(copy.a.data() == owned.a.data());
+        test(copy.is_valid());
+
+        // Conversion keeps the value semantics, also for temporaries
+        const View converted = owned;
+        test(&converted.mesh != &owned.mesh);
+        const View temporary = make_problem<R>(8, 4);
+        test(temporary.is_valid());
+
+        // A sweep over `a` on the shared mesh
+        auto swept = owned;
+        std::ranges::fill(swept.a, 2);
+        auto sweep_view = view;
+        sweep_view.a = swept.a;
+
+        ::mhfe::LMHFE<R> s_owned(swept, 1e-10);
+        ::mhfe::LMHFE<R> s_view(sweep_view, 1e-10);
+        ::mhfe::LMHFE<R> s_temp(temporary, 1e-10);
+        ::mhfe::LMHFE<R> s_base(view, 1e-10);
+        for (uz _ : range(0uz, 3uz)) {
+            s_owned.step();
+            s_view.step();
+            s_temp.step();
+            s_base.step();
+        }
+        test(&s_view.get_prob().mesh == &owned.mesh);
+        test(std::ranges::equal(
+            s_owned.get_solution(), s_view.get_solution()
+        ));
+        test(std::ranges::equal(
+            s_temp.get_solution(), s_base.get_solution()
+        ));
+    }
+}; // <-- problem_view
+
 const UnitTest fin_diff{
     "fin_diff", [] {
         test(prob.is_valid());
@@ -105,6 +454,38 @@ const UnitTest fin_diff{
     }
 }; // <-- fin_diff
 
+const UnitTest fin_diff_subset{
+    "fin_diff_subset", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+        const auto f = [] (const auto& v) {
+            return std::reduce(v.cbegin(), v.cend()) / v.size();
+        }; // <-- f
+
+        ::mhfe::Options<R> options{ .precond = ::mhfe::Preconditioner::ilu0 };
+        ::mhfe::FinDiff<R> all(small, 1e-10, 1e-6, options);
+
+        const std::vector<uz> cells{ 7, 0, small.cells - 1 };
+        options.threads = 3;
+        ::mhfe::FinDiff<R> some(small, 1e-10, 1e-6, cells, options);
+        test(std::ranges::equal(some.get_cells(), cells));
+
+        for (uz _ : range(0uz, 5uz)) {
+            all.step();
+            some.step();
+        }
+
+        // Members do not depend on each other or on the thread count
+        const auto s_all  = all.get_sensitivity(f);
+        const auto s_some = some.get_sensitivity(f);
+        test(s_some.size() == cells.size());
+        for (auto [ c_idx, s ] : std::views::zip(cells, s_some)) {
+            test(s == s_all[c_idx]);
+        }
+    }
+}; // <-- fin_diff_subset
+
 const UnitTest fwd_diff{
     "fwd_diff", [] {
         test(prob.is_valid());
@@ -138,4 +519,344 @@ const UnitTest fwd_diff{
     }
 }; // <-- fwd_diff
 
+const UnitTest fwd_diff_threads{
+    "fwd_diff_threads", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+
+        const auto g_wrt_P = [] (const auto& P, auto& out) {
+            std::ranges::fill(out, 1.0 / P.size());
+        }; // <-- g_wrt_P
+        const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+
+        using Solver = ::mhfe::FwdDiff<
+            R, decltype(g_wrt_P), decltype(g_wrt_a)
+        >;
+
+        // AMG also covers the per-worker preconditioner copies
+        ::mhfe::Options<R> options{
+            .precond    = ::mhfe::Preconditioner::amg,
+            .block_size = 3,
+        };
+        Solver serial(small, 1e-10, g_wrt_P, g_wrt_a, options);
+        options.threads = 4;
+        Solver threaded(small, 1e-10, g_wrt_P, g_wrt_a, options);
+
+        for (uz _ : range(0uz, 5uz)) {
+            serial.step();
+            threaded.step();
+        }
+
+        // Bitwise, not just close
+        test(std::ranges::equal(
+            serial.get_sensitivity(), threaded.get_sensitivity()
+        ));
+
+        // Every thread's workspace stays within `Options::block_size`'s
+        // estimate, with room for the small per-RHS buffers
+        const auto basis = ::math::gmres::block_basis(options.gmres);
+        const auto per_thread = options.block_size * (basis + 5)
+                              * small.edges * sizeof(R);
+        test(serial.get_workspace_bytes() <= 2 * per_thread);
+        test(threaded.get_workspace_bytes() <= 2 * 4 * per_thread);
+    }
+}; // <-- fwd_diff_threads
+
+const UnitTest adjoint{
+    "adjoint", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+        const ::mhfe::Options<R> options{
+            .solver = ::mhfe::LinearSolver::direct
+        };
+        static constexpr uz steps = 5;
+
+        const auto f = [] (const auto& v) {
+            return std::reduce(v.cbegin(), v.cend()) / v.size();
+        }; // <-- f
+        const auto g_wrt_P = [] (const auto& P, auto& out) {
+            std::ranges::fill(out, 1.0 / P.size());
+        }; // <-- g_wrt_P
+        const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+
+        ::mhfe::Adjoint<R, decltype(g_wrt_P), decltype(g_wrt_a)> adj(
+            small, 1e-12, g_wrt_P, g_wrt_a, options
+        );
+        ::mhfe::FwdDiff<R, decltype(g_wrt_P), decltype(g_wrt_a)> fwd(
+            small, 1e-12, g_wrt_P, g_wrt_a, options
+        );
+        ::mhfe::FinDiff<R> fin(small, 1e-12, 1e-6, options);
+
+        for (uz _ : range(0uz, steps)) {
+            adj.step();
+            fwd.step();
+            fin.step();
+        }
+
+        const auto& s_adj = adj.get_sensitivity();
+        const auto& s_fwd = fwd.get_sensitivity();
+        const auto  s_fin = fin.get_sensitivity(f);
+
+        test(all_close_scaled(s_fin, s_adj, 1e-3));
+        test(all_close_scaled(s_fin, s_fwd, 1e-3));
+        test(all_close_scaled(s_fwd, s_adj, 1e-9));
+    }
+}; // <-- adjoint
+
+const UnitTest adjoint_cg{
+    "adjoint_cg", [] {
+        using R = f64;
+
+        // Sensitivities through the eliminated system agree with the
+        // identity-row one
+        const auto small = make_problem<R>(8, 4);
+        const ::mhfe::Options<R> direct{
+            .solver = ::mhfe::LinearSolver::direct
+        };
+        const ::mhfe::Options<R> cg{
+            .solver = ::mhfe::LinearSolver::cg,
+            // `FwdDiff`'s and `FinDiff`'s solves stay GMRES
+            .gmres  = { .max_iters = 1000 },
+            .cg     = { .max_iters = 1000 },
+        };
+        static constexpr uz steps = 5;
+
+        const auto f = [] (const auto& v) {
+            return std::reduce(v.cbegin(), v.cend()) / v.size();
+        }; // <-- f
+        const auto g_wrt_P = [] (const auto& P, auto& out) {
+            std::ranges::fill(out, 1.0 / P.size());
+        }; // <-- g_wrt_P
+        const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+
+        using Adj = ::mhfe::Adjoint<R, decltype(g_wrt_P), decltype(g_wrt_a)>;
+        using Fwd = ::mhfe::FwdDiff<R, decltype(g_wrt_P), decltype(g_wrt_a)>;
+        Adj adj_ref(small, 1e-12, g_wrt_P, g_wrt_a, direct);
+        Adj adj(small, 1e-12, g_wrt_P, g_wrt_a, cg);
+        Fwd fwd(small, 1e-12, g_wrt_P, g_wrt_a, cg);
+        ::mhfe::FinDiff<R> fin(small, 1e-12, 1e-6, cg);
+
+        for (uz _ : range(0uz, steps)) {
+            adj_ref.step();
+            adj.step();
+            fwd.step();
+            fin.step();
+        }
+
+        const auto& s_ref = adj_ref.get_sensitivity();
+        const auto  s_fin = fin.get_sensitivity(f);
+        test(all_close_scaled(s_ref, adj.get_sensitivity(), 1e-8));
+        test(all_close_scaled(s_ref, fwd.get_sensitivity(), 1e-8));
+        test(all_close_scaled(s_ref, s_fin, 1e-3));
+    }
+}; // <-- adjoint_cg
+
+const UnitTest checkpoint{
+    "checkpoint", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+        const ::mhfe::Options<R> options{
+            .solver = ::mhfe::LinearSolver::direct
+        };
+        static constexpr uz steps = 20;
+
+        ::mhfe::LMHFE<R> solver(small, 1e-12, options);
+
+        // Room for the initial, the last and 3 more states
+        ::mhfe::Checkpointer<R> cp(solver, 5 * solver.get_state_bytes());
+
+        std::vector<std::vector<R>> reference;
+        for (uz _ : range(0uz, steps)) {
+            solver.step();
+            cp.record(solver);
+            reference.push_back(solver.get_solution());
+        }
+
+        uz n = steps;
+        cp.reverse(solver, [&] (const auto& s) {
+            test(n > 0);
+            --n;
+            test(is_close(s.get_time(), (n + 1) * small.tau, 1e-12));
+            test(std::ranges::equal(s.get_solution(), reference[n]));
+        });
+        test(n == 0);
+        test(std::ranges::equal(solver.get_solution(), reference.back()));
+
+        const auto& report = cp.get_report();
+        std::println(
+            "    - {} steps, {} snapshots, {} recomputed ({}x)",
+            report.steps, report.snapshots, report.recomputed,
+            report.overhead()
+        );
+        test(report.steps == steps);
+        test(report.snapshots <= 5);
+        test(report.recomputed > steps);
+
+        // The adjoint does not depend on the budget
+        const auto g_wrt_P = [] (const auto& P, auto& out) {
+            std::ranges::fill(out, 1.0 / P.size());
+        }; // <-- g_wrt_P
+        const auto g_wrt_a = [] (auto& out) { std::ranges::fill(out, 0); };
+        using Adjoint = ::mhfe::Adjoint<
+            R, decltype(g_wrt_P), decltype(g_wrt_a)
+        >;
+
+        Adjoint all(small, 1e-12, g_wrt_P, g_wrt_a, options);
+        auto bounded_options = options;
+        bounded_options.checkpoint_budget = 3 * solver.get_state_bytes();
+        Adjoint bounded(small, 1e-12, g_wrt_P, g_wrt_a, bounded_options);
+        for (uz _ : range(0uz, steps)) {
+            all.step();
+            bounded.step();
+        }
+
+        test(std::ranges::equal(
+            all.get_sensitivity(), bounded.get_sensitivity()
+        ));
+        test(all.get_checkpoint_report().recomputed == 0);
+        test(bounded.get_checkpoint_report().recomputed > 0);
+    }
+}; // <-- checkpoint
+
+const UnitTest checkpoint_recycle{
+    "checkpoint_recycle", [] {
+        using R = f64;
+
+        const auto small = make_problem<R>(8, 4);
+        const ::mhfe::Options<R> options{
+            .gmres = { .max_iters = 2000, .restart = 10, .recycle = 4 }
+        };
+        static constexpr uz steps = 12;
+
+        ::mhfe::LMHFE<R> solver(small, 1e-10, options);
+
+        // Forces recomputation, which has to start from the recycled space
+        // of the forward run to reproduce it
+        ::mhfe::Checkpointer<R> cp(solver, 4 * solver.get_state_bytes());
+
+        std::vector<std::vector<R>> reference;
+        std::vector<uz> iterations;
+        for (uz _ : range(0uz, steps)) {
+            solver.step();
+            cp.record(solver);
+            reference.push_back(solver.get_solution());
+            iterations.push_back(solver.get_iterations());
+        }
+        test(solver.get_iteration_history() == iterations);
+
+        uz n = steps;
+        cp.reverse(solver, [&] (const auto& s) {
+            test(n > 0);
+            --n;
+            test(std::ranges::equal(s.get_solution(), reference[n]));
+            // Recomputed steps take as many iterations and are not appended
+            test(s.get_iteration_history() == iterations);
+        });
+        test(n == 0);
+        test(cp.get_report().recomputed > steps);
+        test(solver.get_iteration_history() == iterations);
+    }
+}; // <-- checkpoint_recycle
+
+const UnitTest output{
+    "output", [] {
+        namespace output = ::mhfe::output;
+
+        struct FileDeleter {
+            const std::filesystem::path tp{ "output_test" };
+            ~FileDeleter() {
+                for (auto ext : { ".bin", ".index", ".mesh.bin", ".xdmf" }) {
+                    auto file = tp;
+                    file += ext;
+                    std::filesystem::remove(file);
+                }
+            }
+        } tp {};
+
+        const auto small = make_problem<Real>(8, 4);
+        ::mhfe::LMHFE<Real> solver(small, 1e-7);
+
+        // Edge values are their indices
+        const auto edge_ids = range(0uz, small.edges)
+                            | std::views::transform(
+                                [] (uz e) { return static_cast<Real>(e); }
+                            )
+                            | std::ranges::to<std::vector>();
+        const std::vector<uz> cells{ 5, 0, 17 };
+        const std::vector<uz> edges{ 3, 1 };
+
+        static constexpr uz steps = 5;
+        std::vector<std::vector<Real>> expected;
+        {
+            output::Writer<Real> writer{
+                tp.tp, small.mesh,
+                {
+                    { .name = "solution" },
+                    { .name = "ids", .centering = output::Centering::edge },
+                },
+                { .stride = 2, .cells = cells, .edges = edges }
+            };
+            for (uz step : range(0uz, steps)) {
+                test(writer.is_due() == (step % 2 == 0));
+                solver.step();
+                const auto& sol = solver.get_solution();
+                if (writer.push(solver.get_time(), { sol, edge_ids })) {
+                    auto& frame = expected.emplace_back();
+                    for (auto c_idx : cells) frame.push_back(sol[c_idx]);
+                    for (auto e_idx : edges) frame.push_back(edge_ids[e_idx]);
+                }
+            }
+            test(writer.get_frames() == 3);
+        }
+
+        const auto read_all = [] (const std::filesystem::path& path) {
+            std::ifstream file{ path, std::ios::binary };
+            return std::vector<char>(
+                std::istreambuf_iterator<char>{ file },
+                std::istreambuf_iterator<char>{}
+            );
+        }; // <-- read_all(path)
+        const auto with = [&tp] (std::string_view ext) {
+            auto ret = tp.tp;
+            ret += ext;
+            return ret;
+        }; // <-- with(ext)
+
+        const auto data = read_all(with(".bin"));
+        test(data.size() == expected.size() * 5 * sizeof(Real));
+        for (auto [ f, frame ] : enumerate(expected)) {
+            std::vector<Real> stored(frame.size());
+            std::memcpy(
+                stored.data(), data.data() + f * 5 * sizeof(Real),
+                5 * sizeof(Real)
+            );
+            test(stored == frame);
+        }
+
+        const auto index = read_all(with(".index"));
+        test(index.size() == 3 * sizeof(output::IndexEntry));
+        output::IndexEntry last;
+        std::memcpy(
+            &last, index.data() + 2 * sizeof(output::IndexEntry), sizeof(last)
+        );
+        test(last.step == 4);
+        test(last.offset == 2 * 5 * sizeof(Real));
+        test(last.time == static_cast<f64>(solver.get_time()));
+
+        const auto mesh_bin = read_all(with(".mesh.bin"));
+        test(
+            mesh_bin.size()
+            == small.points * 2 * sizeof(Real) + (3 * 3 + 2 * 2) * sizeof(u64)
+        );
+
+        const auto xdmf = read_all(with(".xdmf"));
+        const std::string_view text{ xdmf.data(), xdmf.size() };
+        test(text.contains(R"(CollectionType="Temporal")"));
+        test(text.contains(R"(<Attribute Name="ids")"));
+    }
+}; // <-- output
+
 } // <-- namespace test::mhfe::lmhfe
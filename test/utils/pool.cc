@@ -0,0 +1,56 @@
+import test_utils;
+
+namespace test::utils::pool {
+
+const UnitTest each_once{
+    "each_once", [] {
+        ::utils::ThreadPool pool{ 4 };
+        test(pool.size() == 4);
+
+        for (uz grain : { 1uz, 3uz, 64uz, 1000uz }) {
+            std::vector<std::atomic<uz>> hits(517);
+            std::vector<std::atomic<uz>> by_worker(pool.size());
+
+            pool.parallel_for(
+                hits.size(),
+                [&] (uz i, uz worker) {
+                    ++hits[i];
+                    ++by_worker.at(worker);
+                },
+                grain
+            );
+
+            test(std::ranges::all_of(hits, [] (const auto& h) {
+                return h == 1;
+            }));
+
+            uz total = 0;
+            for (const auto& w : by_worker) total += w;
+            test(total == hits.size());
+        }
+    }
+}; // <-- each_once
+
+const UnitTest repeated{
+    "repeated", [] {
+        ::utils::ThreadPool pool{ 3 };
+
+        std::vector<uz> out(100);
+        for (uz run : range(0uz, 200uz)) {
+            pool.parallel_for(out.size(), [&] (uz i, uz) { out[i] = i + run; });
+            test(out.front() == run && out.back() == out.size() - 1 + run);
+        }
+
+        // Empty ranges and a single thread run inline
+        pool.parallel_for(0, [] (uz, uz) { test(false); });
+
+        ::utils::ThreadPool single{ 1 };
+        single.parallel_for(out.size(), [&] (uz i, uz worker) {
+            test(worker == 0);
+            out[i] = 0;
+        });
+        test(std::ranges::all_of(out, [] (uz v) { return v == 0; }));
+    }
+}; // <-- repeated
+
+} // <-- namespace test::utils::pool